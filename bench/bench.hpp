@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace me::bench {
+
+	struct Options {
+		int samples = 31;          // Timed runs per case (median/p99 are taken over these)
+		int warmup = 3;            // Untimed runs before sampling
+		bool quick = false;        // Skip the largest sizes
+		std::string filter;        // Only run cases whose name contains this
+	};
+
+	struct Result {
+		std::string name;
+		std::size_t ops = 0;       // Operations per sample
+		int samples = 0;
+		double median_ns = 0.0;    // Per operation
+		double p99_ns = 0.0;
+		double min_ns = 0.0;
+		double mean_ns = 0.0;
+	};
+
+	class Runner {
+	public:
+		explicit Runner(Options options) : m_options(std::move(options)) {}
+
+		const Options& options() const { return m_options; }
+		const std::vector<Result>& results() const { return m_results; }
+
+		bool enabled(const std::string& name) const {
+			return m_options.filter.empty() || name.find(m_options.filter) != std::string::npos;
+		}
+
+		// `body` performs `ops` operations and returns an integer derived from them (kept so the work isn't optimized out).
+		// `teardown` runs untimed after every sample.
+		template <typename Body, typename Teardown>
+		void run(const std::string& name, std::size_t ops, int samples, Body&& body, Teardown&& teardown) {
+			if (!enabled(name)) return;
+			if (samples <= 0) samples = m_options.samples;
+
+			using clock = std::chrono::steady_clock;
+
+			for (int i = 0; i < m_options.warmup; ++i) {
+				m_sink = m_sink ^ static_cast<std::uint64_t>(body());
+				teardown();
+			}
+
+			std::vector<double> per_op;
+			per_op.reserve(samples);
+
+			for (int i = 0; i < samples; ++i) {
+				const auto start = clock::now();
+				m_sink = m_sink ^ static_cast<std::uint64_t>(body());
+				const auto end = clock::now();
+				teardown();
+
+				const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+				per_op.push_back(ns / static_cast<double>(std::max<std::size_t>(ops, 1)));
+			}
+
+			std::sort(per_op.begin(), per_op.end());
+
+			Result r;
+			r.name = name;
+			r.ops = ops;
+			r.samples = samples;
+			r.median_ns = percentile(per_op, 0.50);
+			r.p99_ns = percentile(per_op, 0.99);
+			r.min_ns = per_op.front();
+			for (double v : per_op) r.mean_ns += v;
+			r.mean_ns /= static_cast<double>(per_op.size());
+
+			std::printf("%-36s %10zu %12.2f %12.2f %12.2f\n", r.name.c_str(), r.ops, r.median_ns, r.p99_ns, r.min_ns);
+			std::fflush(stdout);
+
+			m_results.push_back(std::move(r));
+		}
+
+		template <typename Body>
+		void run(const std::string& name, std::size_t ops, Body&& body) {
+			run(name, ops, 0, std::forward<Body>(body), [] {});
+		}
+
+		static void print_header() {
+			std::printf("%-36s %10s %12s %12s %12s\n", "case", "ops", "median ns", "p99 ns", "min ns");
+		}
+
+	private:
+		// Nearest-rank percentile of sorted samples
+		static double percentile(const std::vector<double>& sorted, double p) {
+			const std::size_t rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+			return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+		}
+
+		Options m_options;
+		std::vector<Result> m_results;
+		volatile std::uint64_t m_sink = 0;
+	};
+
+} // namespace me::bench
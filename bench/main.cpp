@@ -0,0 +1,628 @@
+// engine_bench: micro-benchmarks for the engine's hot paths.
+//
+//   engine_bench [--out baseline.json] [--compare old.json] [--filter name] [--samples N] [--workers N] [--quick]
+//
+// Runs headless. Times are nanoseconds per operation; the JSON output is sorted and
+// stable so two baselines can be diffed directly (or passed back in with --compare).
+
+#include "bench.hpp"
+
+#include <mini-engine-raylib/core/engine.hpp>
+#include <mini-engine-raylib/core/frame_arena.hpp>
+#include <mini-engine-raylib/core/jobs.hpp>
+#include <mini-engine-raylib/ecs/changes.hpp>
+#include <mini-engine-raylib/ecs/commands.hpp>
+#include <mini-engine-raylib/ecs/components.hpp>
+#include <mini-engine-raylib/ecs/snapshot.hpp>
+#include <mini-engine-raylib/ecs/view.hpp>
+#include <mini-engine-raylib/input/input.hpp>
+#include <mini-engine-raylib/scene/scene.hpp>
+#include <mini-engine-raylib/scene/scene_file.hpp>
+#include <mini-engine-raylib/spatial/spatial.hpp>
+
+#include "assets/assets_internal.hpp"
+#include "ecs/transform_internal.hpp"
+#include "render/render_internal.hpp"
+#include "render/sprite_batch.hpp"
+
+#include <mini-ecs/registry.hpp>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+using namespace me::components;
+
+namespace {
+
+	const char* size_label(std::size_t n) {
+		switch (n) {
+			case 1'000: return "1k";
+			case 10'000: return "10k";
+			case 100'000: return "100k";
+			case 1'000'000: return "1m";
+			default: return "n";
+		}
+	}
+
+	std::string case_name(const char* base, std::size_t n) {
+		return std::string(base) + "/" + size_label(n);
+	}
+
+	// Entities created in me::get_registry() by a case
+	void destroy_all(std::vector<me::entity::entity_id>& entities) {
+		auto& reg = me::get_registry();
+		for (auto e : entities) reg.destroy_entity(e);
+		entities.clear();
+	}
+
+	// ---- ECS: view<T>() iteration, try_get_component joins, me::view / me::group joins ----
+
+	void bench_registry(me::bench::Runner& runner) {
+		std::vector<std::size_t> sizes = { 1'000, 100'000 };
+		if (!runner.options().quick) sizes.push_back(1'000'000);
+
+		for (std::size_t n : sizes) {
+			if (!runner.enabled(case_name("ecs/view", n)) && !runner.enabled(case_name("ecs/view_join", n)) &&
+				!runner.enabled(case_name("ecs/join_view", n)) && !runner.enabled(case_name("ecs/join_group", n))) continue;
+
+			me::Registry reg;
+			for (std::size_t i = 0; i < n; ++i) {
+				me::Entity e = reg.create_entity("Entity");
+				reg.add_component(e, TransformComponent{ static_cast<float>(i), 0.0f, 0.0f });
+				if (i % 2 == 0) reg.add_component(e, MeshRendererComponent{});
+			}
+
+			runner.run(case_name("ecs/view", n), n, [&] {
+				auto& pool = reg.view<TransformComponent>();
+				std::uint64_t sum = 0;
+				for (std::size_t i = 0; i < pool.size(); ++i)
+					sum += static_cast<std::uint64_t>(pool.components[i].x);
+				return sum;
+			});
+
+			// Same shape as render_world: walk meshes, look up each transform
+			runner.run(case_name("ecs/view_join", n), n / 2, [&] {
+				auto& pool = reg.view<MeshRendererComponent>();
+				std::uint64_t sum = 0;
+				for (std::size_t i = 0; i < pool.size(); ++i) {
+					if (auto* t = reg.try_get_component<TransformComponent>(pool.entity_map[i]))
+						sum += static_cast<std::uint64_t>(t->x);
+				}
+				return sum;
+			});
+
+			runner.run(case_name("ecs/join_view", n), n / 2, [&] {
+				std::uint64_t sum = 0;
+				for (auto [e, mesh, t] : me::view<MeshRendererComponent, TransformComponent>(reg))
+					sum += static_cast<std::uint64_t>(t.x);
+				return sum;
+			});
+
+			// Includes the per-call revalidation against both pools
+			runner.run(case_name("ecs/join_group", n), n / 2, [&] {
+				const auto& group = me::group<MeshRendererComponent, TransformComponent>(reg);
+				std::uint64_t sum = 0;
+				for (std::size_t k = 0; k < group.size(); ++k)
+					sum += static_cast<std::uint64_t>(group.get<TransformComponent>(k).x);
+				return sum;
+			});
+		}
+	}
+
+	// ---- ECS: deferred spawning through command buffers vs direct registry calls ----
+
+	void bench_commands(me::bench::Runner& runner) {
+		const std::size_t n = 100'000;
+		if (!runner.enabled("ecs/spawn_direct/100k") && !runner.enabled("ecs/spawn_commands/100k")) return;
+
+		me::Registry reg;
+		std::vector<me::entity::entity_id> spawned;
+		auto despawn = [&] {
+			auto& pool = reg.view<TransformComponent>();
+			spawned.assign(pool.entity_map.begin(), pool.entity_map.end());
+			for (auto e : spawned) reg.destroy_entity(e);
+		};
+
+		runner.run("ecs/spawn_direct/100k", n, 0, [&] {
+			for (std::size_t i = 0; i < n; ++i) {
+				me::Entity e = reg.create_entity("Entity");
+				reg.add_component(e, TransformComponent{ static_cast<float>(i) });
+				reg.add_component(e, MeshRendererComponent{});
+			}
+			return static_cast<std::uint64_t>(reg.view<TransformComponent>().size());
+		}, despawn);
+
+		// Recorded from workers, applied in one flush
+		runner.run("ecs/spawn_commands/100k", n, 0, [&] {
+			me::jobs::parallel_for(0, n, 4096, [](std::size_t i) {
+				auto& buffer = me::commands::local();
+				auto e = buffer.create();
+				buffer.add(e, TransformComponent{ static_cast<float>(i) });
+				buffer.add(e, MeshRendererComponent{});
+			});
+			me::commands::flush(reg);
+			return static_cast<std::uint64_t>(me::commands::stats().added);
+		}, despawn);
+	}
+
+	// ---- ECS: change tracking, 1% of transforms written per frame ----
+
+	void bench_changes(me::bench::Runner& runner) {
+		const std::size_t n = 100'000;
+		if (!runner.enabled("ecs/changed_sparse/100k")) return;
+
+		me::Registry reg;
+		for (std::size_t i = 0; i < n; ++i) {
+			me::Entity e = reg.create_entity("Entity");
+			reg.add_component(e, TransformComponent{ static_cast<float>(i) });
+		}
+
+		auto& pool = reg.view<TransformComponent>();
+		me::ChangeTracker<TransformComponent> tracker;
+		me::changes::Tick tick = 1;
+		tracker.update(reg, tick);
+
+		// Scan plus visiting only the written ones
+		runner.run("ecs/changed_sparse/100k", n, [&] {
+			for (std::size_t i = tick % 100; i < pool.size(); i += 100) pool.components[i].x += 1.0f;
+			const me::changes::Tick since = tick++;
+			tracker.update(reg, tick);
+
+			std::uint64_t visited = 0;
+			for (auto [e, t] : tracker.changed(since)) visited += static_cast<std::uint64_t>(t.x) & 1;
+			return visited;
+		});
+	}
+
+	// ---- Transforms: cached world matrices, all static vs all written ----
+
+	void bench_transform(me::bench::Runner& runner) {
+		std::vector<std::size_t> sizes = { 10'000, 100'000 };
+		if (!runner.options().quick) sizes.push_back(1'000'000);
+
+		for (std::size_t n : sizes) {
+			const char* names[] = { "transform/update_static", "transform/update_dirty", "transform/centroid_aos", "transform/centroid_soa" };
+			if (std::none_of(std::begin(names), std::end(names), [&](const char* name) { return runner.enabled(case_name(name, n)); })) continue;
+
+			me::Registry reg;
+			for (std::size_t i = 0; i < n; ++i) {
+				me::Entity e = reg.create_entity("Entity");
+				const float f = static_cast<float>(i);
+				reg.add_component(e, TransformComponent{ f, 0.0f, f, 0.0f, f, 0.0f });
+			}
+			me::transform::internal_update(reg);
+
+			runner.run(case_name("transform/update_static", n), n, [&] {
+				me::transform::internal_update(reg);
+				return static_cast<std::uint64_t>(me::transform::stats().recomputed);
+			});
+
+			auto& pool = reg.view<TransformComponent>();
+			runner.run(case_name("transform/update_dirty", n), n, [&] {
+				for (std::size_t i = 0; i < pool.size(); ++i) pool.components[i].rot_y += 1.0f;
+				me::transform::internal_update(reg);
+				return static_cast<std::uint64_t>(me::transform::stats().recomputed);
+			});
+
+			// Same reduction over the pool (strided members) and over the SoA mirror (contiguous rows)
+			runner.run(case_name("transform/centroid_aos", n), n, [&] {
+				float x = 0.0f, y = 0.0f, z = 0.0f;
+				for (std::size_t i = 0; i < pool.size(); ++i) {
+					x += pool.components[i].x;
+					y += pool.components[i].y;
+					z += pool.components[i].z;
+				}
+				return static_cast<std::uint64_t>(x + y + z);
+			});
+
+			using Soa = me::transform::TransformSoa;
+			const Soa& soa = me::transform::soa();
+			runner.run(case_name("transform/centroid_soa", n), n, [&] {
+				float x = 0.0f, y = 0.0f, z = 0.0f;
+				for (std::size_t c = 0; c < soa.chunk_count(); ++c) {
+					const float* xs = soa.field(c, Soa::index_of(&TransformComponent::x));
+					const float* ys = soa.field(c, Soa::index_of(&TransformComponent::y));
+					const float* zs = soa.field(c, Soa::index_of(&TransformComponent::z));
+					for (std::size_t l = 0; l < soa.chunk_length(c); ++l) {
+						x += xs[l];
+						y += ys[l];
+						z += zs[l];
+					}
+				}
+				return static_cast<std::uint64_t>(x + y + z);
+			});
+		}
+
+		// Roots with 3-deep chains below them; every root moves, so every node is re-multiplied
+		const std::size_t roots = 25'000;
+		if (runner.enabled("transform/hierarchy_dirty/100k")) {
+			auto& reg = me::get_registry();
+			std::vector<me::entity::entity_id> entities;
+			for (std::size_t i = 0; i < roots; ++i) {
+				me::entity::entity_id parent = 0;
+				for (int depth = 0; depth < 4; ++depth) {
+					me::Entity e = reg.create_entity("Entity");
+					reg.add_component(e, TransformComponent{ 1.0f, 0.0f, 0.0f, 0.0f, static_cast<float>(i), 10.0f });
+					if (depth > 0) me::transform::set_parent(e, parent);
+					parent = e;
+					entities.push_back(e);
+				}
+			}
+			me::transform::internal_update(reg);
+
+			auto& pool = reg.view<TransformComponent>();
+			runner.run("transform/hierarchy_dirty/100k", roots * 4, 0, [&] {
+				for (std::size_t i = 0; i < entities.size(); i += 4) reg.try_get_component<TransformComponent>(entities[i])->x += 1.0f;
+				me::transform::internal_update(reg);
+				return static_cast<std::uint64_t>(me::transform::stats().hierarchy_recomputed + pool.size());
+			}, [] { me::frame_arena().begin_frame(); });
+
+			destroy_all(entities);
+		}
+	}
+
+	// ---- Spatial: tree sync (static / all drifting) and sphere queries ----
+
+	void bench_spatial(me::bench::Runner& runner) {
+		std::vector<std::size_t> sizes = { 10'000, 100'000 };
+		auto& reg = me::get_registry();
+
+		for (std::size_t n : sizes) {
+			if (!runner.enabled(case_name("spatial/update_static", n)) && !runner.enabled(case_name("spatial/update_moving", n)) &&
+				!runner.enabled(case_name("spatial/query_sphere", n))) continue;
+
+			// Grid on the XZ plane, 2 units apart
+			const std::size_t side = static_cast<std::size_t>(std::sqrt(static_cast<double>(n)));
+			std::vector<me::entity::entity_id> entities;
+			for (std::size_t i = 0; i < n; ++i) {
+				me::Entity e = reg.create_entity("Entity");
+				reg.add_component(e, TransformComponent{ static_cast<float>(i % side) * 2.0f, 0.0f, static_cast<float>(i / side) * 2.0f });
+				entities.push_back(e);
+			}
+			me::spatial::update();
+			me::frame_arena().begin_frame();
+
+			runner.run(case_name("spatial/update_static", n), n, 0, [&] {
+				me::spatial::update();
+				return static_cast<std::uint64_t>(me::spatial::stats().moved);
+			}, [] { me::frame_arena().begin_frame(); });
+
+			// Everything drifts; a leaf is re-inserted only when it leaves its margin
+			auto& pool = reg.view<TransformComponent>();
+			runner.run(case_name("spatial/update_moving", n), n, 0, [&] {
+				for (std::size_t i = 0; i < pool.size(); ++i) pool.components[i].x += 0.05f;
+				me::spatial::update();
+				return static_cast<std::uint64_t>(me::spatial::stats().moved);
+			}, [] { me::frame_arena().begin_frame(); });
+
+			const std::size_t queries = 1'000;
+			std::vector<me::entity::entity_id> found;
+			runner.run(case_name("spatial/query_sphere", n), queries, [&] {
+				std::uint64_t total = 0;
+				for (std::size_t q = 0; q < queries; ++q) {
+					const float x = static_cast<float>((q * 7919) % side) * 2.0f;
+					const float z = static_cast<float>((q * 104729) % side) * 2.0f;
+					total += me::spatial::query_sphere({ x, 0.0f, z }, 5.0f, found);
+				}
+				return total;
+			});
+
+			destroy_all(entities);
+			me::spatial::update();
+			me::frame_arena().begin_frame();
+		}
+	}
+
+	// ---- Input: action/axis lookups by name ----
+
+	void bench_input(me::bench::Runner& runner) {
+		me::input::bind_action("Jump", me::input::Key::Space);
+		me::input::bind_action("Jump", me::input::MouseButton::Left);
+		me::input::poll();
+
+		constexpr std::size_t k_calls = 10'000;
+
+		runner.run("input/action_pressed", k_calls, [] {
+			std::uint64_t hits = 0;
+			for (std::size_t i = 0; i < k_calls; ++i)
+				hits += me::input::action_pressed("Jump") ? 1 : 0;
+			return hits;
+		});
+
+		runner.run("input/axis_value", k_calls, [] {
+			float sum = 0.0f;
+			for (std::size_t i = 0; i < k_calls; ++i)
+				sum += me::input::axis_value("MoveX");
+			return static_cast<std::uint64_t>(sum != 0.0f);
+		});
+	}
+
+	// ---- Assets: TextureId -> texture record ----
+
+	void bench_assets(me::bench::Runner& runner) {
+		constexpr std::size_t k_textures = 256;
+		constexpr std::size_t k_calls = 10'000;
+
+		// Headless loads only register handles
+		std::vector<me::assets::TextureId> ids;
+		for (std::size_t i = 0; i < k_textures; ++i)
+			ids.push_back(me::assets::load_texture(("bench/texture_" + std::to_string(i) + ".png").c_str()));
+
+		runner.run("assets/resolve_texture", k_calls, [&] {
+			std::uint64_t found = 0;
+			for (std::size_t i = 0; i < k_calls; ++i) {
+#if ME_HAS_RAYLIB
+				found += me::assets::internal_get_texture(ids[i % k_textures]) != nullptr;
+#else
+				found += me::assets::internal_get_texture_path(ids[i % k_textures]) != nullptr;
+#endif
+			}
+			return found;
+		});
+
+		for (auto id : ids) me::assets::release(id);
+	}
+
+	// ---- Scene: JSON save/load of the global registry ----
+
+	class BenchScene : public me::Scene {
+	public:
+		const char* get_name() const override { return "Bench"; }
+		const char* get_file() const override { return "bench_scene.json"; }
+	};
+
+	void bench_scene(me::bench::Runner& runner) {
+		std::vector<std::size_t> sizes = { 10'000 };
+		if (!runner.options().quick) sizes.push_back(100'000);
+
+		auto& reg = me::get_registry();
+		BenchScene scene;
+
+		for (std::size_t n : sizes) {
+			const char* names[] = { "scene/save", "scene/load", "scene/save_binary", "scene/load_binary", "scene/snapshot_capture", "scene/snapshot_restore" };
+			if (std::none_of(std::begin(names), std::end(names), [&](const char* name) { return runner.enabled(case_name(name, n)); })) continue;
+
+			std::vector<me::entity::entity_id> entities;
+			for (std::size_t i = 0; i < n; ++i) {
+				me::Entity e = reg.create_entity("Entity");
+				reg.add_component(e, TransformComponent{ static_cast<float>(i), 1.0f, 2.0f, 0.0f, 45.0f, 0.0f });
+				if (i % 10 == 0) reg.add_component(e, Camera2DComponent{});
+				entities.push_back(e);
+			}
+
+			const int samples = n >= 100'000 ? 5 : 11;
+
+			runner.run(case_name("scene/save", n), n, samples, [&] {
+				return static_cast<std::uint64_t>(scene.save_to_file());
+			}, [] {});
+
+			runner.run(case_name("scene/snapshot_capture", n), n, [&] {
+				return static_cast<std::uint64_t>(me::snapshot::capture(reg).byte_size());
+			});
+
+			// Level restart after values moved: the same entities, one memcpy per pool
+			me::snapshot::Snapshot snapshot = me::snapshot::capture(reg);
+			auto& moved = reg.view<TransformComponent>();
+			runner.run(case_name("scene/snapshot_restore", n), n, [&] {
+				for (std::size_t i = 0; i < moved.size(); i += 16) moved.components[i].x += 1.0f;
+				return static_cast<std::uint64_t>(me::snapshot::restore(reg, snapshot));
+			});
+
+			// Not next to bench_scene.json, so scene/load keeps reading the JSON
+			const std::filesystem::path cooked = std::filesystem::current_path() / "scenes" / "bench_cooked.mescene";
+			runner.run(case_name("scene/save_binary", n), n, samples, [&] {
+				return static_cast<std::uint64_t>(me::scene_file::save_binary(cooked));
+			}, [] {});
+
+			// Make sure the files exist even when only a load was selected
+			scene.save_to_file();
+			me::scene_file::save_binary(cooked);
+			destroy_all(entities);
+
+			auto& transforms = reg.view<TransformComponent>();
+			runner.run(case_name("scene/load", n), n, samples, [&] {
+				return static_cast<std::uint64_t>(scene.load_from_file());
+			}, [&] {
+				for (std::size_t i = 0; i < transforms.size(); ++i) entities.push_back(transforms.entity_map[i]);
+				destroy_all(entities);
+			});
+
+			runner.run(case_name("scene/load_binary", n), n, samples, [&] {
+				return static_cast<std::uint64_t>(me::scene_file::load_binary(cooked));
+			}, [&] {
+				for (std::size_t i = 0; i < transforms.size(); ++i) entities.push_back(transforms.entity_map[i]);
+				destroy_all(entities);
+			});
+		}
+	}
+
+	// ---- Render: render_world's CPU side (camera pick + draw list + frustum culling) ----
+
+	void bench_render(me::bench::Runner& runner) {
+		std::vector<std::size_t> sizes = { 10'000, 100'000 };
+		auto& reg = me::get_registry();
+
+		me::render::ViewParams view;
+		view.aspect = 16.0f / 9.0f;
+		view.screen_height = 1080.0f;
+
+		for (std::size_t n : sizes) {
+			if (!runner.enabled(case_name("render/build_world", n))) continue;
+
+			std::vector<me::entity::entity_id> entities;
+			me::Entity cam = reg.create_entity("Camera");
+			reg.add_component(cam, TransformComponent{ 0.0f, 10.0f, -20.0f });
+			reg.add_component(cam, CameraComponent{});
+			entities.push_back(cam);
+
+			for (std::size_t i = 0; i < n; ++i) {
+				me::Entity e = reg.create_entity("Entity");
+				reg.add_component(e, TransformComponent{ static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100) });
+				reg.add_component(e, MeshRendererComponent{ static_cast<MeshRendererComponent::Type>(i % 3) });
+				entities.push_back(e);
+			}
+
+			runner.run(case_name("render/build_world", n), n, 0, [&] {
+				return static_cast<std::uint64_t>(me::render::internal_build_world(reg, view).packets.size());
+			}, [] { me::frame_arena().begin_frame(); });
+
+			destroy_all(entities);
+		}
+
+		for (std::size_t n : sizes) {
+			if (!runner.enabled(case_name("render/build_sprites", n)) && !runner.enabled(case_name("render/sprite_quads", n))) continue;
+
+			std::vector<me::entity::entity_id> entities;
+			for (std::size_t i = 0; i < n; ++i) {
+				me::Entity e = reg.create_entity("Entity");
+				reg.add_component(e, TransformComponent{ static_cast<float>(i % 100), static_cast<float>(i / 100), static_cast<float>(i % 7) });
+				reg.add_component(e, SpriteComponent{ me::assets::TextureId{ static_cast<std::uint32_t>(i % 16 + 1) } });
+				entities.push_back(e);
+			}
+
+			runner.run(case_name("render/build_sprites", n), n, 0, [&] {
+				return static_cast<std::uint64_t>(me::render::internal_build_sprites(reg).packets.size());
+			}, [] { me::frame_arena().begin_frame(); });
+
+			// CPU side of the sprite batcher: rotated quads for every packet
+			const std::string quads_name = case_name("render/sprite_quads", n);
+			if (runner.enabled(quads_name)) {
+				for (std::size_t i = 0; i < entities.size(); ++i)
+					reg.try_get_component<TransformComponent>(entities[i])->rot_z = static_cast<float>(i % 360);
+
+				const auto& frame = me::render::internal_build_sprites(reg);
+				std::vector<me::render::SpriteVertex> vertices(frame.packets.size() * 4);
+
+				runner.run(quads_name, n, [&] {
+					me::render::internal_build_sprite_quads(frame, 0, frame.packets.size(), 32.0f, 32.0f, vertices.data());
+					return static_cast<std::uint64_t>(vertices.back().x);
+				});
+			}
+
+			destroy_all(entities);
+		}
+	}
+
+	// ---- Output ----
+
+	json to_json(const me::bench::Runner& runner) {
+		json root;
+		root["meta"] = {
+			{ "raylib", static_cast<bool>(ME_HAS_RAYLIB) },
+#ifdef NDEBUG
+			{ "optimized", true },
+#else
+			{ "optimized", false },
+#endif
+			{ "samples", runner.options().samples },
+			{ "workers", me::jobs::worker_count() },
+			{ "unit", "ns/op" },
+		};
+
+		json results = json::object();
+		for (const auto& r : runner.results()) {
+			results[r.name] = {
+				{ "ops", r.ops }, { "samples", r.samples },
+				{ "median", r.median_ns }, { "p99", r.p99_ns }, { "min", r.min_ns }, { "mean", r.mean_ns },
+			};
+		}
+		root["results"] = std::move(results);
+		return root;
+	}
+
+	void compare(const me::bench::Runner& runner, const fs::path& path) {
+		std::ifstream ifs(path);
+		json old;
+		try { ifs >> old; } catch (...) {
+			std::cerr << "engine_bench: can't read baseline " << path.string() << "\n";
+			return;
+		}
+
+		std::printf("\n%-36s %12s %12s %9s\n", "case", "old median", "new median", "change");
+		for (const auto& r : runner.results()) {
+			if (!old["results"].contains(r.name)) continue;
+			const double before = old["results"][r.name].value("median", 0.0);
+			if (before <= 0.0) continue;
+			std::printf("%-36s %12.2f %12.2f %+8.1f%%\n", r.name.c_str(), before, r.median_ns, (r.median_ns / before - 1.0) * 100.0);
+		}
+	}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	me::bench::Options options;
+	fs::path out_path = "engine_bench.json";
+	fs::path compare_path;
+	int workers = -1;              // me::jobs workers for parallel paths (render extraction). -1 = none, 0 = one per core
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		const bool has_value = i + 1 < argc;
+
+		if (arg == "--quick") options.quick = true;
+		else if (arg == "--out" && has_value) out_path = argv[++i];
+		else if (arg == "--compare" && has_value) compare_path = argv[++i];
+		else if (arg == "--filter" && has_value) options.filter = argv[++i];
+		else if (arg == "--samples" && has_value) options.samples = std::max(1, std::atoi(argv[++i]));
+		else if (arg == "--workers" && has_value) workers = std::atoi(argv[++i]);
+		else {
+			std::cerr << "usage: engine_bench [--out file.json] [--compare old.json] [--filter name] [--samples N] [--workers N] [--quick]\n";
+			return 1;
+		}
+	}
+
+	out_path = fs::absolute(out_path);
+	if (!compare_path.empty()) compare_path = fs::absolute(compare_path);
+
+	me::AppConfig config;
+	config.headless = true;
+	config.worker_threads = workers;
+	if (!me::init(config)) return 1;
+
+	// Scene files are written to <cwd>/scenes, keep them out of the caller's tree
+	const fs::path work_dir = fs::temp_directory_path() / "engine_bench";
+	fs::create_directories(work_dir / "scenes");
+	fs::current_path(work_dir);
+
+#ifndef NDEBUG
+	std::printf("warning: unoptimized build, numbers are not representative\n");
+#endif
+
+	me::bench::Runner runner(options);
+	me::bench::Runner::print_header();
+
+	bench_registry(runner);
+	bench_commands(runner);
+	bench_changes(runner);
+	bench_transform(runner);
+	bench_spatial(runner);
+	bench_input(runner);
+	bench_assets(runner);
+	bench_scene(runner);
+	bench_render(runner);
+
+	std::ofstream ofs(out_path);
+	if (!ofs) {
+		std::cerr << "engine_bench: can't write " << out_path.string() << "\n";
+		me::shutdown();
+		return 1;
+	}
+	ofs << to_json(runner).dump(2) << "\n";
+	std::printf("\nwrote %s\n", out_path.string().c_str());
+
+	if (!compare_path.empty()) compare(runner, compare_path);
+
+	me::shutdown();
+	return 0;
+}
@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace me::assets {
 
@@ -23,7 +24,48 @@ namespace me::assets {
 
 	bool is_texture_valid(TextureId id);
 
+	// URI the texture was loaded under (nullptr if invalid). Runtime-packed atlases have names, not files.
+	const char* texture_uri(TextureId id);
+
 	// Query texture size in pixels (0,0 if invalid)
 	me::math::Vec2 texture_size(TextureId id);
 
+	// ---- Texture atlases ----
+
+	// Normalized sub-rectangle of a texture (default: the whole texture)
+	struct UvRect { float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f; };
+
+	struct AtlasId { std::uint32_t handle = 0; };
+
+	// One packed image: the atlas texture and where the image sits in it
+	struct AtlasRegion {
+		TextureId texture{};         // handle == 0 if the region doesn't exist
+		UvRect uv{};
+		int width = 0, height = 0;   // Source image size in pixels
+	};
+
+	struct AtlasOptions {
+		int max_size = 4096;         // Largest atlas side in pixels
+		int padding = 2;             // Pixels kept free around every image
+		bool extrude = true;         // Fill the padding with edge pixels so filtering/mips don't bleed neighbours
+		bool mipmaps = false;        // Runtime packing only: generate mipmaps and use trilinear filtering
+	};
+
+	// Loads "<uri>.atlas.json" written by atlas_cook if it exists, otherwise packs every image in folder <uri>
+	// at runtime. Regions are named by their path inside the folder, without extension ("ui/button").
+	AtlasId load_atlas(const char* uri, const AtlasOptions& options = {});
+
+	// Runtime packing of the given image URIs. Regions are named by URI without extension.
+	AtlasId pack_atlas(const char* name, const std::vector<std::string>& uris, const AtlasOptions& options = {});
+
+	// Offline cook step: packs every image in `folder` (a plain path, not under the asset root) and writes
+	// "<out_base>.png" and "<out_base>.atlas.json". Returns false if an image can't be read or nothing fits.
+	bool cook_atlas(const char* folder, const char* out_base, const AtlasOptions& options = {});
+
+	// Looks a packed image up by name
+	AtlasRegion atlas_region(AtlasId atlas, const char* name);
+
+	// Drops the atlas and its reference on the atlas texture
+	void release_atlas(AtlasId atlas);
+
 } // namespace me::assets
\ No newline at end of file
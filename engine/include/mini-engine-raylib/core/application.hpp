@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace me {
@@ -10,6 +11,24 @@ namespace me {
 		int height = 720;
 		bool vsync = false;
 		int target_fps = 0;
+
+		// No window, input, audio or GPU. on_update runs unthrottled (or at target_fps if set).
+		// Combined with fixed_tick_rate (and no target_fps) every frame advances exactly one tick.
+		bool headless = false;
+
+		// Fixed-step simulation. 0 = disabled (on_fixed_update is never called)
+		int fixed_tick_rate = 0;     // Ticks per second (e.g. 60)
+		int max_fixed_steps = 5;     // Max ticks per frame, extra time is dropped (spiral-of-death clamp)
+
+		// Bytes per buffer of me::frame_arena() (it grows to the observed peak if exceeded)
+		std::size_t frame_arena_size = 4 * 1024 * 1024;
+
+		// me::jobs worker threads. 0 = one per core minus the main thread, < 0 = none (jobs run inline)
+		int worker_threads = 0;
+
+		// Deterministic record/replay (see me::replay). Empty = off.
+		std::string record_file;     // Log every frame's dt and input here
+		std::string replay_file;     // Drive the session from this log; the app closes when it ends
 	};
 
 	class Application {
@@ -22,14 +41,18 @@ namespace me {
 		// Called when the window changes size
 		virtual void on_resize(int width, int height) {}
 
+		// Called 0..N times per frame when AppConfig::fixed_tick_rate is set. dt = fixed step in seconds.
+		virtual void on_fixed_update(float /*dt*/) {}
+
 		// Called every frame. dt = delta time in seconds.
 		virtual void on_update(float dt) {}
 
-		// Called every frame after clearing the screen
+		// Called every frame after clearing the screen. me::time::alpha() gives the progress between the last
+		// two fixed ticks, to interpolate rendered state.
 		virtual void on_render() {}
 
 		// Called when the window is closing
 		virtual void on_shutdown() {}
 	};
 
-} // namespace me
\ No newline at end of file
+} // namespace me
@@ -11,6 +11,10 @@ namespace me {
 	bool init(const AppConfig& config);
 	void run(Application& app, const AppConfig& config = {});
 
+	// Undoes init(): stops the job workers and releases the registry, assets and platform. run() calls it on
+	// exit; tools that only call init() must call it before returning from main. Does nothing if not initialized.
+	void shutdown();
+
 	// Global Accessors
 	Registry& get_registry();
 
@@ -20,4 +24,7 @@ namespace me {
 	int get_window_width();
 	int get_window_height();
 
+	// True when running without a window/GPU/audio (AppConfig::headless or a build without raylib)
+	bool is_headless();
+
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace me {
+
+	// Bump allocator: allocation is a pointer bump, memory is only reclaimed by reset().
+	// When the main block runs out it chains overflow blocks, and the next reset() grows
+	// the main block to the peak so steady-state frames never touch the heap.
+	class LinearArena {
+	public:
+		explicit LinearArena(std::size_t capacity = 0);
+		~LinearArena();
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		void* allocate(std::size_t size, std::size_t align = alignof(std::max_align_t));
+		void reset();
+		void reserve(std::size_t capacity);
+
+		std::size_t used() const { return m_used + m_overflow_used; }
+		std::size_t capacity() const { return m_capacity; }
+		std::size_t high_water() const { return m_high_water; }
+		std::size_t overflow_count() const { return m_overflow_count; }
+
+	private:
+		std::byte* m_block = nullptr;
+		std::size_t m_capacity = 0;
+		std::size_t m_used = 0;
+
+		std::vector<std::byte*> m_overflow;   // Freed on reset()
+		std::size_t m_overflow_used = 0;
+		std::size_t m_overflow_left = 0;
+		std::byte* m_overflow_cursor = nullptr;
+
+		std::size_t m_high_water = 0;
+		std::size_t m_overflow_count = 0;
+	};
+
+	// std::pmr adaptor over a LinearArena. deallocate() is a no-op.
+	class ArenaResource final : public std::pmr::memory_resource {
+	public:
+		explicit ArenaResource(LinearArena& arena) : m_arena(arena) {}
+
+	private:
+		void* do_allocate(std::size_t bytes, std::size_t align) override { return m_arena.allocate(bytes, align); }
+		void do_deallocate(void*, std::size_t, std::size_t) override {}
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+		LinearArena& m_arena;
+	};
+
+	struct FrameArenaStats {
+		std::size_t used = 0;          // Bytes allocated this frame
+		std::size_t capacity = 0;      // Bytes per buffer before overflowing to the heap
+		std::size_t high_water = 0;    // Peak bytes used by any single frame
+		std::size_t overflows = 0;     // Frames that had to fall back to the heap
+	};
+
+	// Double-buffered per-frame arena, reset at the top of every me::run iteration.
+	// Memory allocated in frame N stays valid through frame N+1. Main thread only.
+	class FrameArena {
+	public:
+		explicit FrameArena(std::size_t capacity_per_frame = 0);
+
+		void* allocate(std::size_t size, std::size_t align = alignof(std::max_align_t)) {
+			return m_arenas[m_current].allocate(size, align);
+		}
+
+		// Uninitialized storage for `count` objects (use for trivially destructible types)
+		template <typename T>
+		std::span<T> allocate_array(std::size_t count) {
+			static_assert(std::is_trivially_destructible_v<T>, "Frame arena memory is never destroyed");
+			return { static_cast<T*>(allocate(sizeof(T) * count, alignof(T))), count };
+		}
+
+		template <typename T, typename... Args>
+		T* create(Args&&... args) {
+			static_assert(std::is_trivially_destructible_v<T>, "Frame arena memory is never destroyed");
+			return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+		}
+
+		// Resource for the current frame's buffer, e.g. me::frame_vector<int> v(me::frame_arena().resource());
+		std::pmr::memory_resource* resource() { return &m_resources[m_current]; }
+
+		// Swaps buffers and resets the one that is now two frames old
+		void begin_frame();
+		void reserve(std::size_t capacity_per_frame);
+
+		FrameArenaStats stats() const;
+
+	private:
+		LinearArena m_arenas[2];
+		ArenaResource m_resources[2] = { ArenaResource(m_arenas[0]), ArenaResource(m_arenas[1]) };
+		int m_current = 0;
+		std::size_t m_overflow_frames = 0;
+	};
+
+	template <typename T>
+	using frame_vector = std::pmr::vector<T>;
+
+	// Engine-owned frame arena (sized by AppConfig::frame_arena_size)
+	FrameArena& frame_arena();
+
+} // namespace me
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <span>
+
+namespace me::jobs {
+
+	namespace detail { struct Counter; }
+
+	using Job = std::function<void()>;
+
+	// Completion handle for a submitted job. A default-constructed handle counts as done.
+	class Handle {
+	public:
+		bool is_done() const;
+
+	private:
+		friend struct Access;
+		std::shared_ptr<detail::Counter> m_counter;
+	};
+
+	// Starts the work-stealing pool. 0 = one worker per core, minus the main thread.
+	// Called by me::init (AppConfig::worker_threads), shut down in me::run's cleanup.
+	void init(unsigned worker_count = 0);
+	void shutdown();
+
+	unsigned worker_count();
+
+	// 0 for the main thread (or any non-worker thread), 1..worker_count() on workers
+	unsigned thread_index();
+
+	// Queues a job. With no workers running, it executes inline before returning.
+	Handle submit(Job job);
+
+	// Queues a job that only starts once every dependency has completed
+	Handle submit(Job job, std::span<const Handle> dependencies);
+	Handle submit(Job job, std::initializer_list<Handle> dependencies);
+
+	// Blocks until the handle completes, running queued jobs on this thread in the meantime
+	void wait(const Handle& handle);
+
+	// Runs fn(chunk_begin, chunk_end) over [begin, end) split into chunks of at most `grain`.
+	// The caller helps and the call returns once every chunk is done.
+	void parallel_for_chunks(std::size_t begin, std::size_t end, std::size_t grain,
+		const std::function<void(std::size_t, std::size_t)>& fn);
+
+	// Per-index convenience: fn(i) for every i in [begin, end)
+	template <typename Fn>
+	void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, Fn&& fn) {
+		parallel_for_chunks(begin, end, grain, [&fn](std::size_t b, std::size_t e) {
+			for (std::size_t i = b; i < e; ++i) fn(i);
+		});
+	}
+
+} // namespace me::jobs
@@ -20,6 +20,23 @@ namespace me::math {
         }
     };
 
+    struct Vec3 {
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+
+        Vec3 operator+(const Vec3& v) const { return { x + v.x, y + v.y, z + v.z }; }
+        Vec3 operator-(const Vec3& v) const { return { x - v.x, y - v.y, z - v.z }; }
+        Vec3 operator*(float scalar) const { return { x * scalar, y * scalar, z * scalar }; }
+
+        float dot(const Vec3& v) const { return x * v.x + y * v.y + z * v.z; }
+        float length() const { return std::sqrt(x * x + y * y + z * z); }
+
+        Vec3 normalize() const {
+            float len = length();
+            if (len > 0) return { x / len, y / len, z / len };
+            return { 0.0f, 0.0f, 0.0f };
+        }
+    };
+
     static constexpr float pi = 3.14159265358979323846f;
 
 } // namespace me::math
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+// Zones are only recorded when the engine is built with the ME_ENABLE_PROFILER CMake option.
+// Otherwise every macro below expands to nothing.
+#ifndef ME_ENABLE_PROFILER
+#define ME_ENABLE_PROFILER 0
+#endif
+
+namespace me::profiler {
+
+	// Starts/stops recording. Outside a capture a zone costs one relaxed atomic load.
+	void begin_capture();
+	void end_capture();
+	bool is_capturing();
+
+	// Writes the zones recorded by the last capture as Chrome trace JSON (open in chrome://tracing or
+	// ui.perfetto.dev). Call it after end_capture(): returns false while capturing or if the file can't be
+	// written. Zones still open when the capture ends aren't recorded.
+	bool dump_chrome_trace(const char* path);
+
+	// Events kept per thread. When a thread's ring is full the oldest events are overwritten.
+	constexpr std::uint32_t k_events_per_thread = 1u << 16;
+
+#if ME_ENABLE_PROFILER
+	// Records [construction, destruction) on the calling thread. `name` must outlive the capture.
+	class ScopedZone {
+	public:
+		explicit ScopedZone(const char* name) noexcept;
+		~ScopedZone() noexcept;
+
+		ScopedZone(const ScopedZone&) = delete;
+		ScopedZone& operator=(const ScopedZone&) = delete;
+
+	private:
+		const char* m_name;
+		std::int64_t m_start;
+	};
+
+	// Records a sampled value (shown as a graph track in the trace)
+	void counter(const char* name, double value) noexcept;
+#endif
+
+} // namespace me::profiler
+
+#if ME_ENABLE_PROFILER
+#define ME_PROFILE_CONCAT_INNER(a, b) a##b
+#define ME_PROFILE_CONCAT(a, b) ME_PROFILE_CONCAT_INNER(a, b)
+
+#define ME_PROFILE_SCOPE(name) ::me::profiler::ScopedZone ME_PROFILE_CONCAT(me_profile_zone_, __LINE__)(name)
+#define ME_PROFILE_FUNCTION() ME_PROFILE_SCOPE(__func__)
+#define ME_PROFILE_COUNTER(name, value) ::me::profiler::counter(name, static_cast<double>(value))
+#else
+#define ME_PROFILE_SCOPE(name) ((void)0)
+#define ME_PROFILE_FUNCTION() ((void)0)
+#define ME_PROFILE_COUNTER(name, value) ((void)0)
+#endif
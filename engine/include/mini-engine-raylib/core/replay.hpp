@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+namespace me::replay {
+
+	// Records every frame's dt and input snapshot into a compact binary log.
+	// Also started automatically by me::run when AppConfig::record_file is set.
+	bool start_recording(const char* path);
+	void stop_recording();
+	bool is_recording();
+
+	// Feeds a recorded log back through me::input and me::time instead of the live platform,
+	// so the session runs the same in windowed or headless mode. Stops at the end of the log
+	// (and closes the application when started from AppConfig::replay_file).
+	bool start_playback(const char* path);
+	void stop_playback();
+	bool is_playing();
+
+	// Frames recorded or played back so far
+	std::uint64_t frame_index();
+
+} // namespace me::replay
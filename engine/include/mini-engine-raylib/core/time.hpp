@@ -2,8 +2,18 @@
 
 namespace me::time {
 
+	// Frame delta in seconds (the recorded one while replaying)
 	float delta();
+
+	// Sum of every frame delta since me::run started, so it replays identically
 	double elapsed();
+
 	int get_fps();
 
-} // namespace me::time
\ No newline at end of file
+	// Fixed-step length in seconds (0 if fixed step is disabled)
+	float fixed_delta();
+
+	// Interpolation factor [0, 1) between the last two fixed ticks
+	float alpha();
+
+} // namespace me::time
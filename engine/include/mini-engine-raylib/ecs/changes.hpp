@@ -0,0 +1,297 @@
+#pragma once
+
+#include "mini-engine-raylib/ecs/view.hpp"
+
+#include <mini-ecs/registry.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace me::components {
+	struct TransformComponent;
+} // namespace me::components
+
+namespace me::changes {
+
+	// Frame counter for change detection. Starts at 1 and is advanced by the engine at the top of every frame,
+	// so `since = 0` means "everything" and a system that remembers tick() can later ask what changed after it ran.
+	using Tick = std::uint64_t;
+
+	Tick tick();
+
+	// Removal events are kept for this many ticks; a system that slept longer should treat everything as changed
+	inline constexpr Tick k_removed_history = 600;
+
+	// Per pool slot, the entity and the serial of the last scan that found the component written (or the entity
+	// new to the slot). `serial` is the current scan's.
+	struct WrittenSlots {
+		std::span<const me::entity::entity_id> entities;
+		std::span<const std::uint64_t> written;
+		std::uint64_t serial = 0;
+	};
+
+	// Types whose writes another system already detects. A specialization defines `static WrittenSlots
+	// scan(Registry&)` and ChangeTracker stamps from it instead of keeping a shadow copy.
+	template <typename T>
+	struct WriteSource {};
+
+	// Transforms: the transform cache's dirty slots (transform_system.cpp), as of its latest update this tick, so
+	// writes after the frame's update get the next tick. A transform moved to another slot by a swap-remove
+	// counts as written.
+	template <>
+	struct WriteSource<components::TransformComponent> {
+		static WrittenSlots scan(Registry& reg);
+	};
+
+	template <typename T>
+	concept HasWriteSource = requires(Registry& reg) { { WriteSource<T>::scan(reg) } -> std::same_as<WrittenSlots>; };
+
+} // namespace me::changes
+
+namespace me {
+
+	// Change ticks for one component type, indexed like its pool. mini-ecs pools have no write hooks, so writes are
+	// found when update() rescans the pool, not when they happen. Types with a changes::WriteSource (transforms)
+	// take the written slots from it; others are compared bytewise with a shadow copy from the previous update.
+	// Entities keep their ticks when the pool reorders (swap-removes).
+	//
+	//   auto& tracker = me::changes::track<TransformComponent>(reg);
+	//   if (tracker.version() > m_last) for (auto [e, t] : tracker.changed(m_last)) { ... }
+	//   m_last = me::changes::tick();
+	template <typename T>
+	class ChangeTracker {
+		static_assert(std::is_trivially_copyable_v<T>, "Change tracking compares components bytewise");
+
+	public:
+		using Tick = changes::Tick;
+
+		struct Removal {
+			me::entity::entity_id entity;
+			Tick tick;
+		};
+
+		// Rescans the pool and stamps added/changed slots and removals with `now`
+		void update(Registry& reg, Tick now) {
+			changes::WrittenSlots source;
+			if constexpr (k_sourced) source = changes::WriteSource<T>::scan(reg);
+
+			auto& pool = reg.template view<T>();
+			const std::size_t n = pool.size();
+			m_pool = &pool;
+			m_tick = now;
+
+			// Another registry: everything in it is new
+			if (m_owner != &reg) {
+				m_owner = &reg;
+				m_entities.clear();
+				m_shadow.clear();
+				m_added.clear();
+				m_changed.clear();
+				m_removed.clear();
+			}
+
+			// Fast path: same entity in the same slot, only the values need comparing
+			const std::size_t common = std::min(n, m_entities.size());
+			std::size_t i = 0;
+			for (; i < common; ++i) {
+				if (m_entities[i] != pool.entity_map[i]) break;
+				if constexpr (k_sourced) {
+					if (source.written[i] <= m_serial) continue;
+				} else {
+					if (std::memcmp(&m_shadow[i], &pool.components[i], sizeof(T)) == 0) continue;
+					std::memcpy(&m_shadow[i], &pool.components[i], sizeof(T));
+				}
+				m_changed[i] = now;
+				m_version = now;
+			}
+
+			if (i < n || i < m_entities.size()) remap(pool, source, i, now);
+			m_serial = source.serial;
+			trim_removed(now);
+		}
+
+		// Tick of the last add, change or removal anywhere in the pool (0 = never)
+		Tick version() const { return m_version; }
+
+		// Tick of the last update() and the registry it scanned
+		Tick last_update() const { return m_tick; }
+		const Registry* owner() const { return m_owner; }
+
+		std::size_t size() const { return m_entities.size(); }
+		me::entity::entity_id entity(std::size_t slot) const { return m_entities[slot]; }
+		Tick added_tick(std::size_t slot) const { return m_added[slot]; }
+		Tick changed_tick(std::size_t slot) const { return m_changed[slot]; }    // Adds count as changes
+
+		// Slots whose ticks are newer than `since`. Yields std::tuple<entity_id, T&> like me::view; valid until the
+		// pool gains or loses components.
+		class Filter {
+		public:
+			Filter(const ChangeTracker* tracker, const std::vector<Tick>* ticks, Tick since) : m_tracker(tracker), m_ticks(ticks), m_since(since) {}
+
+			class iterator {
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = std::tuple<me::entity::entity_id, T&>;
+				using difference_type = std::ptrdiff_t;
+
+				iterator() = default;
+				iterator(const Filter* filter, std::size_t slot) : m_filter(filter), m_slot(slot) { settle(); }
+
+				value_type operator*() const { return value_type(m_filter->m_tracker->m_entities[m_slot], m_filter->m_tracker->m_pool->components[m_slot]); }
+				iterator& operator++() { ++m_slot; settle(); return *this; }
+				iterator operator++(int) { iterator old = *this; ++*this; return old; }
+				bool operator==(const iterator& other) const { return m_slot == other.m_slot; }
+
+			private:
+				void settle() {
+					const auto& ticks = *m_filter->m_ticks;
+					while (m_slot < ticks.size() && ticks[m_slot] <= m_filter->m_since) ++m_slot;
+				}
+
+				const Filter* m_filter = nullptr;
+				std::size_t m_slot = 0;
+			};
+
+			// Nothing newer than `since` in the whole pool skips the scan
+			iterator begin() const { return iterator(this, m_tracker->m_version > m_since ? 0 : m_ticks->size()); }
+			iterator end() const { return iterator(this, m_ticks->size()); }
+
+		private:
+			const ChangeTracker* m_tracker;
+			const std::vector<Tick>* m_ticks;
+			Tick m_since;
+		};
+
+		// Components added or written after `since`
+		Filter changed(Tick since) const { return Filter(this, &m_changed, since); }
+
+		// Components added after `since`
+		Filter added(Tick since) const { return Filter(this, &m_added, since); }
+
+		// Entities that lost the component after `since`, oldest first (kept for k_removed_history ticks)
+		std::span<const Removal> removed(Tick since) const {
+			auto it = std::upper_bound(m_removed.begin(), m_removed.end(), since, [](Tick t, const Removal& r) { return t < r.tick; });
+			return { it, m_removed.end() };
+		}
+
+	private:
+		using Pool = detail::pool_t<T>;
+
+		static constexpr bool k_sourced = changes::HasWriteSource<T>;
+
+		// Slow path from `first` on: the pool gained, lost or moved entities. Matches slots to the previous scan by entity.
+		void remap(const Pool& pool, const changes::WrittenSlots& source, std::size_t first, Tick now) {
+			const std::size_t n = pool.size();
+			const std::size_t old_n = m_entities.size();
+
+			std::unordered_map<me::entity::entity_id, std::size_t> previous;
+			previous.reserve(old_n - first);
+			for (std::size_t k = first; k < old_n; ++k) previous.emplace(m_entities[k], k);
+
+			std::vector<me::entity::entity_id> entities(m_entities.begin(), m_entities.begin() + first);
+			std::vector<T> shadow;
+			std::vector<Tick> added(m_added.begin(), m_added.begin() + first);
+			std::vector<Tick> changed(m_changed.begin(), m_changed.begin() + first);
+			entities.resize(n);
+			if constexpr (!k_sourced) {
+				shadow.assign(m_shadow.begin(), m_shadow.begin() + first);
+				shadow.resize(n);
+			}
+			added.resize(n);
+			changed.resize(n);
+
+			std::vector<std::uint8_t> seen(old_n, 0);
+			for (std::size_t i = first; i < n; ++i) {
+				const me::entity::entity_id e = pool.entity_map[i];
+				entities[i] = e;
+				if constexpr (!k_sourced) std::memcpy(&shadow[i], &pool.components[i], sizeof(T));
+
+				auto it = previous.find(e);
+				if (it == previous.end()) {
+					added[i] = changed[i] = now;
+					m_version = now;
+					continue;
+				}
+
+				const std::size_t k = it->second;
+				seen[k] = 1;
+				added[i] = m_added[k];
+				changed[i] = m_changed[k];
+				bool written;
+				if constexpr (k_sourced) written = source.written[i] > m_serial;
+				else written = std::memcmp(&m_shadow[k], &pool.components[i], sizeof(T)) != 0;
+				if (written) {
+					changed[i] = now;
+					m_version = now;
+				}
+			}
+
+			for (std::size_t k = first; k < old_n; ++k) {
+				if (seen[k]) continue;
+				m_removed.push_back({ m_entities[k], now });
+				m_version = now;
+			}
+
+			m_entities = std::move(entities);
+			m_shadow = std::move(shadow);
+			m_added = std::move(added);
+			m_changed = std::move(changed);
+		}
+
+		void trim_removed(Tick now) {
+			if (now <= changes::k_removed_history || m_removed.empty() || m_removed.front().tick >= now - changes::k_removed_history) return;
+			auto it = std::upper_bound(m_removed.begin(), m_removed.end(), now - changes::k_removed_history, [](Tick t, const Removal& r) { return t < r.tick; });
+			m_removed.erase(m_removed.begin(), it);
+		}
+
+		const Registry* m_owner = nullptr;
+		Pool* m_pool = nullptr;
+		std::vector<me::entity::entity_id> m_entities;   // Pool order at the last update
+		std::vector<T> m_shadow;                         // Empty for types with a WriteSource
+		std::uint64_t m_serial = 0;                      // WriteSource serial at the last update
+		std::vector<Tick> m_added;
+		std::vector<Tick> m_changed;
+		std::vector<Removal> m_removed;                  // Tick order
+		Tick m_version = 0;
+		Tick m_tick = 0;
+	};
+
+	namespace changes {
+
+		// The shared tracker for T, rescanned at most once per tick (and on a registry switch). Pools are only
+		// scanned for types somebody asks about. Call from the main thread or an exclusive system.
+		template <typename T>
+		ChangeTracker<T>& track(Registry& reg) {
+			static ChangeTracker<T> s_tracker;
+			if (s_tracker.last_update() != tick() || s_tracker.owner() != &reg) s_tracker.update(reg, tick());
+			return s_tracker;
+		}
+
+	} // namespace changes
+
+	// Filters over the shared trackers: entities whose T was added/written after `since`
+	template <typename T>
+	typename ChangeTracker<T>::Filter changed(Registry& reg, changes::Tick since) {
+		return changes::track<T>(reg).changed(since);
+	}
+
+	template <typename T>
+	typename ChangeTracker<T>::Filter added(Registry& reg, changes::Tick since) {
+		return changes::track<T>(reg).added(since);
+	}
+
+	template <typename T>
+	std::span<const typename ChangeTracker<T>::Removal> removed(Registry& reg, changes::Tick since) {
+		return changes::track<T>(reg).removed(since);
+	}
+
+} // namespace me
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "mini-engine-raylib/ecs/type_id.hpp"
+
+#include <mini-ecs/registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace me {
+
+	class CommandBuffer;
+
+	namespace commands {
+		// Last flush / playback
+		struct Stats {
+			std::size_t commands = 0;      // Recorded, before coalescing
+			std::size_t created = 0;
+			std::size_t destroyed = 0;
+			std::size_t added = 0;         // add() that reached a pool (new or replaced component)
+			std::size_t removed = 0;
+			std::size_t coalesced = 0;     // Dropped: overwritten by a later command, duplicate, or dead entity
+		};
+	} // namespace commands
+
+	namespace detail {
+		inline constexpr std::uint64_t k_pending_entity = std::uint64_t{ 1 } << 63;
+		inline constexpr std::uint32_t k_remove_command = ~std::uint32_t{ 0 };
+
+		// One recorded add/remove. target: an entity id, or k_pending_entity | index of a create() in the same buffer.
+		struct ComponentCommand {
+			std::uint64_t target;
+			std::uint32_t sequence;
+			std::uint32_t value;    // Index into the column's values, or k_remove_command
+		};
+
+		class CommandColumn;
+
+		// One buffer's commands for a component type, plus the entities its create() calls produced
+		struct CommandSource {
+			CommandColumn* column;
+			const me::entity::entity_id* created;
+			std::uint32_t buffer;
+		};
+
+		// Commands of one component type, recorded by one buffer
+		class CommandColumn {
+		public:
+			virtual ~CommandColumn() = default;
+
+			// Applies every source's commands (all of this column's type) and clears them
+			virtual void apply(Registry& reg, std::span<const CommandSource> sources, commands::Stats& stats) = 0;
+			virtual void clear() = 0;
+
+			std::vector<ComponentCommand> commands;
+		};
+
+		template <typename T>
+		class TypedCommandColumn final : public CommandColumn {
+		public:
+			std::vector<T> values;
+
+			void clear() override {
+				commands.clear();
+				values.clear();
+			}
+
+			void apply(Registry& reg, std::span<const CommandSource> sources, commands::Stats& stats) override {
+				struct Op {
+					me::entity::entity_id entity;
+					std::uint32_t buffer;
+					std::uint32_t sequence;
+					bool created;    // By this playback: known alive unless destroyed meanwhile
+					T* value;
+				};
+
+				std::size_t total = 0;
+				for (const auto& src : sources) total += src.column->commands.size();
+
+				std::vector<Op> ops;
+				ops.reserve(total);
+				for (const auto& src : sources) {
+					auto& column = static_cast<TypedCommandColumn&>(*src.column);
+					for (const auto& cmd : column.commands) {
+						const bool pending = (cmd.target & k_pending_entity) != 0;
+						const me::entity::entity_id e = pending ? src.created[cmd.target & ~k_pending_entity] : static_cast<me::entity::entity_id>(cmd.target);
+						ops.push_back({ e, src.buffer, cmd.sequence, pending, cmd.value == k_remove_command ? nullptr : &column.values[cmd.value] });
+					}
+				}
+
+				// Entity order (pool writes land in id order); per entity the last command wins. Spawn batches
+				// usually arrive in order already.
+				auto before = [](const Op& a, const Op& b) {
+					if (a.entity != b.entity) return a.entity < b.entity;
+					if (a.buffer != b.buffer) return a.buffer < b.buffer;
+					return a.sequence < b.sequence;
+				};
+				if (!std::is_sorted(ops.begin(), ops.end(), before)) std::sort(ops.begin(), ops.end(), before);
+
+				std::size_t kept = 0;
+				std::size_t adds = 0;
+				for (std::size_t i = 0; i < ops.size(); ++i) {
+					const bool overwritten = i + 1 < ops.size() && ops[i + 1].entity == ops[i].entity;
+					if (overwritten || ((!ops[i].created || stats.destroyed != 0) && !reg.is_alive(ops[i].entity))) {
+						++stats.coalesced;
+						continue;
+					}
+					adds += ops[i].value != nullptr;
+					ops[kept++] = ops[i];
+				}
+
+				// One reallocation for the whole batch instead of amortized growth per add
+				auto& pool = reg.view<T>();
+				pool.components.reserve(pool.components.size() + adds);
+				pool.entity_map.reserve(pool.entity_map.size() + adds);
+
+				for (std::size_t i = 0; i < kept; ++i) {
+					if (ops[i].value) {
+						reg.add_component(ops[i].entity, std::move(*ops[i].value));
+						++stats.added;
+					} else if (reg.template has_component<T>(ops[i].entity)) {
+						reg.template remove_component<T>(ops[i].entity);
+						++stats.removed;
+					}
+				}
+
+				for (const auto& src : sources) src.column->clear();
+			}
+		};
+
+		void playback(Registry& reg, std::span<CommandBuffer* const> buffers, commands::Stats& stats);
+	} // namespace detail
+
+	// Records structural changes (create/destroy entities, add/remove components) to apply later, so systems can
+	// request them while iterating pools or from me::jobs workers. A buffer must only be recorded into by one thread
+	// at a time; use me::commands::local() for the calling thread's own buffer.
+	//
+	// Playback applies creates first, then destroys, then component changes one type at a time. Commands are
+	// sorted by entity and coalesced: per entity and component the last add/remove wins, and changes to entities
+	// that are dead by then are dropped.
+	class CommandBuffer {
+	public:
+		// An entity that will exist after playback; usable as an add() target in the same buffer
+		struct Pending {
+			std::uint32_t index = 0;
+		};
+
+		Pending create(std::string name = "Entity") {
+			m_creates.push_back(std::move(name));
+			++m_count;
+			return Pending{ static_cast<std::uint32_t>(m_creates.size() - 1) };
+		}
+
+		void destroy(me::entity::entity_id e) {
+			m_destroys.push_back(e);
+			++m_count;
+		}
+
+		// Adds or replaces component T
+		template <typename T>
+		void add(me::entity::entity_id e, T component) {
+			record<T>(e, std::move(component));
+		}
+
+		template <typename T>
+		void add(Pending p, T component) {
+			record<T>(detail::k_pending_entity | p.index, std::move(component));
+		}
+
+		template <typename T>
+		void remove(me::entity::entity_id e) {
+			column<T>().commands.push_back({ e, m_sequence++, detail::k_remove_command });
+			++m_count;
+		}
+
+		// Applies every command to reg and clears the buffer. Main thread; nothing may iterate reg meanwhile.
+		commands::Stats playback(Registry& reg);
+
+		void clear();
+
+		std::size_t size() const { return m_count; }
+		bool empty() const { return m_count == 0; }
+
+	private:
+		friend void detail::playback(Registry& reg, std::span<CommandBuffer* const> buffers, commands::Stats& stats);
+
+		template <typename T>
+		detail::TypedCommandColumn<T>& column() {
+			const ComponentTypeId id = component_type_id<T>();
+			if (id >= m_columns.size()) m_columns.resize(id + 1);
+			if (!m_columns[id]) m_columns[id] = std::make_unique<detail::TypedCommandColumn<T>>();
+			return static_cast<detail::TypedCommandColumn<T>&>(*m_columns[id]);
+		}
+
+		template <typename T>
+		void record(std::uint64_t target, T&& component) {
+			auto& col = column<T>();
+			col.commands.push_back({ target, m_sequence++, static_cast<std::uint32_t>(col.values.size()) });
+			col.values.push_back(std::move(component));
+			++m_count;
+		}
+
+		std::vector<std::string> m_creates;
+		std::vector<me::entity::entity_id> m_destroys;
+		std::vector<std::unique_ptr<detail::CommandColumn>> m_columns;  // Indexed by ComponentTypeId
+		std::vector<me::entity::entity_id> m_created;                    // Playback scratch: Pending index -> entity
+		std::uint32_t m_sequence = 0;
+		std::size_t m_count = 0;
+	};
+
+	namespace commands {
+		// The calling thread's buffer (workers included). Recording needs no locks.
+		CommandBuffer& local();
+
+		// Plays back every thread's buffer in thread-registration order. The engine calls this at its sync points:
+		// after each Scene::on_update, after each Application::on_fixed_update tick, and after Application::on_update.
+		// Main thread, with no jobs recording.
+		void flush(Registry& reg);
+
+		Stats stats();
+	} // namespace commands
+
+} // namespace me
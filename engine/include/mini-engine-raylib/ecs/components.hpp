@@ -2,9 +2,13 @@
 
 #include "mini-engine-raylib/render/color.hpp"
 #include "mini-engine-raylib/assets/assets.hpp"
+#include "mini-engine-raylib/ecs/reflect.hpp"
 
 #include <mini-ecs/entity.hpp>
 
+#include <cstdint>
+#include <limits>
+
 namespace me::components {
 
 	struct TransformComponent {
@@ -13,6 +17,13 @@ namespace me::components {
 		float sx = 1.0f, sy = 1.0f, sz = 1.0f;
 	};
 
+	// Makes the entity's TransformComponent relative to `parent`'s world transform.
+	// Set through me::transform::set_parent() / clear_parent().
+	struct ParentComponent {
+		static constexpr me::entity::entity_id none = std::numeric_limits<me::entity::entity_id>::max();
+		me::entity::entity_id parent = none;
+	};
+
 	struct CameraComponent {
 		// Target is where the camera looks at
 		float target_x = 0.0f, target_y = 0.0f, target_z = 0.0f;
@@ -31,13 +42,33 @@ namespace me::components {
 
 	struct MeshRendererComponent {
 		enum Type { Cube, Sphere, Plane } type = Cube;
-		me::Color color = me::Color::white;
+		me::Color color = me::Color::white;  // alpha < 255 draws in the transparent pass (sorted back to front)
 		bool wireframe = false;
+		std::uint8_t layer = 0;              // Lower layers draw first
+		bool lod = true;                     // Spheres use fewer rings/slices as they get smaller on screen
+		float min_screen_size = 0.0f;        // Not drawn below this projected size in pixels (0 = always drawn)
 	};
 
 	struct SpriteComponent {
 		me::assets::TextureId texture{};
 		me::Color tint = me::Color::white;
+		std::uint8_t layer = 0;              // Lower layers draw first, then lower Transform z
+		me::assets::UvRect uv{};             // Part of the texture to draw, e.g. an AtlasRegion's uv
 	};
 
-} // namespace me::components
\ No newline at end of file
+} // namespace me::components
+
+// Field descriptors (me::reflect) drive scene serialization. Names are the scene file's keys, so renaming one
+// breaks existing files.
+ME_REFLECT(me::Color, "Color", ME_FIELD(r), ME_FIELD(g), ME_FIELD(b), ME_FIELD(a));
+ME_REFLECT(me::assets::UvRect, "UvRect", ME_FIELD(u0), ME_FIELD(v0), ME_FIELD(u1), ME_FIELD(v1));
+
+ME_REFLECT(me::components::TransformComponent, "Transform",
+	ME_FIELD(x), ME_FIELD(y), ME_FIELD(z), ME_FIELD(rot_x), ME_FIELD(rot_y), ME_FIELD(rot_z), ME_FIELD(sx), ME_FIELD(sy), ME_FIELD(sz));
+ME_REFLECT(me::components::ParentComponent, "Parent", me::reflect::field("id", &Self::parent));
+ME_REFLECT(me::components::CameraComponent, "Camera",
+	ME_FIELD(target_x), ME_FIELD(target_y), ME_FIELD(target_z), ME_FIELD(up_x), ME_FIELD(up_y), ME_FIELD(up_z), ME_FIELD(fov), ME_FIELD(projection), ME_FIELD(active));
+ME_REFLECT(me::components::Camera2DComponent, "Camera2D", ME_FIELD(offset_x), ME_FIELD(offset_y), ME_FIELD(rotation), ME_FIELD(zoom), ME_FIELD(active));
+ME_REFLECT(me::components::MeshRendererComponent, "MeshRenderer",
+	ME_FIELD(type), ME_FIELD(color), ME_FIELD(wireframe), ME_FIELD(layer), ME_FIELD(lod), ME_FIELD(min_screen_size));
+ME_REFLECT(me::components::SpriteComponent, "Sprite", ME_FIELD(texture), ME_FIELD(tint), ME_FIELD(layer), ME_FIELD(uv));
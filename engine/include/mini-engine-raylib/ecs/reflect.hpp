@@ -0,0 +1,63 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace me::reflect {
+
+	// One described data member: the name it is serialized under and its member pointer
+	template <typename Class, typename Member>
+	struct Field {
+		using class_type = Class;
+		using member_type = Member;
+
+		const char* name;
+		Member Class::* member;
+
+		constexpr Member& get(Class& object) const { return object.*member; }
+		constexpr const Member& get(const Class& object) const { return object.*member; }
+	};
+
+	template <typename Class, typename Member>
+	constexpr Field<Class, Member> field(const char* name, Member Class::* member) { return { name, member }; }
+
+	// Specialized (usually through ME_REFLECT) for every reflected type:
+	//   static constexpr const char* name;   Serialized type name
+	//   static constexpr auto fields;        std::tuple of field()s, in serialization order
+	template <typename T>
+	struct Describe;
+
+	template <typename T>
+	concept Reflected = requires {
+		{ Describe<T>::name } -> std::convertible_to<const char*>;
+		std::tuple_size<std::remove_cvref_t<decltype(Describe<T>::fields)>>::value;
+	};
+
+	template <Reflected T>
+	inline constexpr const char* name_of = Describe<T>::name;
+
+	template <Reflected T>
+	inline constexpr std::size_t field_count = std::tuple_size_v<std::remove_cvref_t<decltype(Describe<T>::fields)>>;
+
+	// Calls fn(field) for every field of T. Unrolled at compile time: each call sees a constant member pointer.
+	template <Reflected T, typename Fn>
+	constexpr void for_each_field(Fn&& fn) {
+		std::apply([&](const auto&... fields) { (fn(fields), ...); }, Describe<T>::fields);
+	}
+
+} // namespace me::reflect
+
+// Describes a type. Use at global scope, after the type is complete:
+//   ME_REFLECT(game::Health, "Health", ME_FIELD(current), ME_FIELD(max));
+#define ME_REFLECT(Type, Name, ...)                                   \
+	template <>                                                       \
+	struct me::reflect::Describe<Type> {                              \
+		using Self = Type;                                            \
+		static constexpr const char* name = Name;                     \
+		static constexpr auto fields = std::make_tuple(__VA_ARGS__);  \
+	}
+
+// A field of the type being described, serialized under its member name
+#define ME_FIELD(member) ::me::reflect::field(#member, &Self::member)
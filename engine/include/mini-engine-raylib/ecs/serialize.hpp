@@ -0,0 +1,363 @@
+#pragma once
+
+#include "mini-engine-raylib/assets/assets.hpp"
+#include "mini-engine-raylib/ecs/changes.hpp"
+#include "mini-engine-raylib/ecs/components.hpp"
+#include "mini-engine-raylib/ecs/reflect.hpp"
+#include "mini-engine-raylib/ecs/view.hpp"
+
+#include <mini-ecs/registry.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace me::serialize {
+
+	using Json = nlohmann::ordered_json;
+
+	// Numbers, bools and strings are written as themselves, enums as their integer, reflected types as an object of
+	// their fields and textures as the URI they were loaded from
+	template <typename T>
+	Json to_json(const T& value) {
+		if constexpr (reflect::Reflected<T>) {
+			Json out = Json::object();
+			reflect::for_each_field<T>([&](const auto& f) { out[f.name] = to_json(f.get(value)); });
+			return out;
+		} else if constexpr (std::is_same_v<T, assets::TextureId>) {
+			const char* uri = assets::texture_uri(value);
+			return uri ? Json(uri) : Json(nullptr);
+		} else if constexpr (std::is_enum_v<T>) {
+			return Json(static_cast<std::underlying_type_t<T>>(value));
+		} else {
+			static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, std::string>, "No JSON mapping for this field type: reflect it");
+			return Json(value);
+		}
+	}
+
+	// Missing or mistyped fields keep what `value` had, so old files load with the current defaults
+	template <typename T>
+	void from_json(const Json& in, T& value) {
+		if constexpr (reflect::Reflected<T>) {
+			if (!in.is_object()) return;
+			reflect::for_each_field<T>([&](const auto& f) {
+				if (auto it = in.find(f.name); it != in.end()) from_json(*it, f.get(value));
+			});
+		} else if constexpr (std::is_same_v<T, assets::TextureId>) {
+			if (in.is_string()) value = assets::load_texture(in.template get_ref<const std::string&>().c_str());
+		} else if constexpr (std::is_enum_v<T>) {
+			if (in.is_number_integer()) value = static_cast<T>(in.template get<std::underlying_type_t<T>>());
+		} else if constexpr (std::is_same_v<T, bool>) {
+			if (in.is_boolean()) value = in.template get<bool>();
+		} else if constexpr (std::is_same_v<T, std::string>) {
+			if (in.is_string()) value = in.template get<std::string>();
+		} else {
+			if (in.is_number()) value = in.template get<T>();
+		}
+	}
+
+	// Streams pretty-printed JSON (the layout of nlohmann's dump(2)) to an ostream through a 64 KiB buffer, so
+	// writing a scene never holds more than that in memory. Calls must nest properly; keys only inside objects.
+	class JsonWriter {
+	public:
+		explicit JsonWriter(std::ostream& out, int indent = 2) : m_out(out), m_indent(indent) {}
+		~JsonWriter() { flush(); }
+
+		JsonWriter(const JsonWriter&) = delete;
+		JsonWriter& operator=(const JsonWriter&) = delete;
+
+		void begin_object();
+		void end_object();
+		void begin_array();
+		void end_array();
+		void key(std::string_view name);
+
+		void value(std::nullptr_t);
+		void value(bool v);
+		void value(std::int64_t v);
+		void value(std::uint64_t v);
+		void value(float v);               // Shortest text that reads back as the same float
+		void value(double v);              // Non-finite values are written as null, like nlohmann
+		void value(std::string_view v);
+
+		void flush();
+
+	private:
+		void open(char bracket);
+		void close(char bracket);
+		void before_value();
+		void quoted(std::string_view text);   // Escaped, in quotes
+		void put(std::string_view text);
+		void put(char c);
+
+		std::ostream& m_out;
+		int m_indent;
+		std::string m_buffer;
+		std::vector<std::size_t> m_counts;    // Members written so far, per open container
+		bool m_after_key = false;
+	};
+
+	// Same mapping as to_json(), written straight to `out`
+	template <typename T>
+	void write_json(JsonWriter& out, const T& value) {
+		if constexpr (reflect::Reflected<T>) {
+			out.begin_object();
+			reflect::for_each_field<T>([&](const auto& f) {
+				out.key(f.name);
+				write_json(out, f.get(value));
+			});
+			out.end_object();
+		} else if constexpr (std::is_same_v<T, assets::TextureId>) {
+			const char* uri = assets::texture_uri(value);
+			if (uri) out.value(std::string_view(uri));
+			else out.value(nullptr);
+		} else if constexpr (std::is_enum_v<T>) {
+			write_json(out, static_cast<std::underlying_type_t<T>>(value));
+		} else if constexpr (std::is_same_v<T, bool>) {
+			out.value(value);
+		} else if constexpr (std::is_same_v<T, std::string>) {
+			out.value(std::string_view(value));
+		} else if constexpr (std::is_same_v<T, float>) {
+			out.value(value);
+		} else if constexpr (std::is_floating_point_v<T>) {
+			out.value(static_cast<double>(value));
+		} else if constexpr (std::is_signed_v<T>) {
+			out.value(static_cast<std::int64_t>(value));
+		} else {
+			static_assert(std::is_unsigned_v<T>, "No JSON mapping for this field type: reflect it");
+			out.value(static_cast<std::uint64_t>(value));
+		}
+	}
+
+	// ---- Binary columns (.mescene, see scene_file.hpp) ----
+
+	// What a column holds. A column is only read back into a field of the same kind and width.
+	enum class ColumnKind : std::uint8_t { Float, Signed, Unsigned, Bool, String, Texture };
+
+	template <typename M>
+	constexpr ColumnKind column_kind() {
+		if constexpr (std::is_same_v<M, assets::TextureId>) return ColumnKind::Texture;
+		else if constexpr (std::is_same_v<M, std::string>) return ColumnKind::String;
+		else if constexpr (std::is_same_v<M, bool>) return ColumnKind::Bool;
+		else if constexpr (std::is_enum_v<M>) return column_kind<std::underlying_type_t<M>>();
+		else if constexpr (std::is_floating_point_v<M>) return ColumnKind::Float;
+		else if constexpr (std::is_signed_v<M>) return ColumnKind::Signed;
+		else {
+			static_assert(std::is_unsigned_v<M>, "No binary mapping for this field type: reflect it");
+			return ColumnKind::Unsigned;
+		}
+	}
+
+	// Bytes per element. Strings and textures (by URI) are u32 indices into the file's string table.
+	template <typename M>
+	constexpr std::uint32_t column_width() {
+		if constexpr (column_kind<M>() == ColumnKind::String || column_kind<M>() == ColumnKind::Texture) return sizeof(std::uint32_t);
+		else return sizeof(M);
+	}
+
+	namespace detail {
+		// Calls fn(name, get, std::type_identity<M>) for every field of T that isn't itself reflected; nested reflected
+		// types are flattened to "outer.inner". get(root) returns a reference to the field.
+		template <reflect::Reflected T, typename Get, typename Fn>
+		void for_each_leaf(std::string& name, Get get, Fn& fn) {
+			reflect::for_each_field<T>([&](const auto& f) {
+				using M = typename std::remove_cvref_t<decltype(f)>::member_type;
+				auto leaf = [get, member = f.member](auto& root) -> auto& { return get(root).*member; };
+
+				const std::size_t length = name.size();
+				name += f.name;
+				if constexpr (reflect::Reflected<M>) {
+					name += '.';
+					for_each_leaf<M>(name, leaf, fn);
+				} else {
+					fn(name, leaf, std::type_identity<M>{});
+				}
+				name.resize(length);
+			});
+		}
+
+		template <reflect::Reflected T, typename Fn>
+		void for_each_leaf(Fn&& fn) {
+			std::string name;
+			for_each_leaf<T>(name, [](auto& root) -> auto& { return root; }, fn);
+		}
+
+		// One pool of a binary scene being written (implemented by scene_file::save_binary)
+		class PoolWriter {
+		public:
+			static constexpr std::uint32_t none = 0xFFFFFFFF;
+
+			virtual ~PoolWriter() = default;
+
+			// File row of the entity in TransformComponent slot `slot`, none if it isn't saved
+			virtual std::uint32_t row(std::size_t slot) const = 0;
+
+			// The pool's entity rows, once, before its columns
+			virtual void rows(std::span<const std::uint32_t> rows) = 0;
+
+			// rows().size() elements of `width` bytes
+			virtual void column(std::string_view name, ColumnKind kind, std::uint32_t width, const void* data) = 0;
+
+			// Index of `text` in the string table
+			virtual std::uint32_t intern(std::string_view text) = 0;
+		};
+
+		// One pool of a binary scene being loaded (implemented by scene_file::load_binary)
+		class PoolReader {
+		public:
+			virtual ~PoolReader() = default;
+
+			// Entities (already created) that own the pool's components, in file order
+			virtual std::span<const me::entity::entity_id> entities() const = 0;
+
+			// entities().size() * width bytes, or nullptr if the file has no such column of this kind and width
+			virtual const std::byte* column(std::string_view name, ColumnKind kind, std::uint32_t width) const = 0;
+
+			// Null-terminated; "" when out of range
+			virtual const char* string(std::uint32_t index) const = 0;
+		};
+
+		// Type-erased scene I/O for one registered component
+		struct ComponentOps {
+			const char* name = "";
+			// Writes `"name": {...}` when e has a T; a scene save calls this per entity, so nothing is buffered
+			bool (*write_json)(JsonWriter& out, Registry& reg, me::entity::entity_id e) = nullptr;
+			void (*load_json)(Registry& reg, me::entity::entity_id e, const Json& in) = nullptr;
+			// One column per leaf field, gathered from the pool
+			void (*save_binary)(Registry& reg, PoolWriter& out) = nullptr;
+			// Fills components from the columns, then adds them with the pool reserved up front
+			void (*load_binary)(Registry& reg, const PoolReader& in) = nullptr;
+			// Change tick of the pool (see ChangeTracker::version); `rescan` forces a scan even if this tick had one
+			changes::Tick (*version)(Registry& reg, bool rescan) = nullptr;
+		};
+
+		void register_component(const ComponentOps& ops);
+	} // namespace detail
+
+	// Components scenes save and load, in registration order. ParentComponent isn't listed: the scene remaps
+	// its entity id and links it through transform::set_parent.
+	std::span<const detail::ComponentOps> components();
+
+	// Saves and loads T with scenes under reflect::name_of<T> (which must be unique). Engine components are
+	// registered already; registering a name again replaces it.
+	template <reflect::Reflected T>
+	void register_component() {
+		using components::TransformComponent;
+
+		detail::ComponentOps ops;
+		ops.name = reflect::name_of<T>;
+		ops.write_json = [](JsonWriter& out, Registry& reg, me::entity::entity_id e) {
+			const T* component = reg.template try_get_component<T>(e);
+			if (!component) return false;
+			out.key(reflect::name_of<T>);
+			write_json(out, *component);
+			return true;
+		};
+		ops.load_json = [](Registry& reg, me::entity::entity_id e, const Json& in) {
+			T component{};
+			from_json(in, component);
+			reg.add_component(e, component);
+		};
+		ops.save_binary = [](Registry& reg, detail::PoolWriter& out) {
+			auto& transforms = reg.template view<TransformComponent>();
+			std::vector<std::uint32_t> rows;
+			std::vector<const T*> values;
+			if constexpr (std::is_same_v<T, TransformComponent>) {
+				for (std::size_t i = 0; i < transforms.size(); ++i) {
+					const std::uint32_t row = out.row(i);
+					if (row == detail::PoolWriter::none) continue;
+					rows.push_back(row);
+					values.push_back(&transforms.components[i]);
+				}
+			} else {
+				const TransformComponent* base = transforms.components.data();
+				for (auto [e, t, c] : me::view<TransformComponent, T>(reg)) {
+					const std::uint32_t row = out.row(static_cast<std::size_t>(&t - base));
+					if (row == detail::PoolWriter::none) continue;
+					rows.push_back(row);
+					values.push_back(&c);
+				}
+			}
+			if (rows.empty()) return;
+
+			out.rows(rows);
+			const std::size_t n = values.size();
+			detail::for_each_leaf<T>([&](const std::string& name, auto get, auto type) {
+				using M = typename decltype(type)::type;
+				constexpr ColumnKind kind = column_kind<M>();
+				constexpr std::uint32_t width = column_width<M>();
+
+				std::vector<std::byte> column(n * width);
+				for (std::size_t i = 0; i < n; ++i) {
+					if constexpr (kind == ColumnKind::Texture || kind == ColumnKind::String) {
+						std::uint32_t index = 0;
+						if constexpr (kind == ColumnKind::Texture) {
+							const char* uri = assets::texture_uri(get(*values[i]));
+							index = out.intern(uri ? uri : "");
+						} else {
+							index = out.intern(get(*values[i]));
+						}
+						std::memcpy(column.data() + i * width, &index, width);
+					} else {
+						std::memcpy(column.data() + i * width, &get(*values[i]), width);
+					}
+				}
+				out.column(name, kind, width, column.data());
+			});
+		};
+		ops.load_binary = [](Registry& reg, const detail::PoolReader& in) {
+			const auto entities = in.entities();
+			const std::size_t n = entities.size();
+			std::vector<T> values(n);
+
+			detail::for_each_leaf<T>([&](const std::string& name, auto get, auto type) {
+				using M = typename decltype(type)::type;
+				constexpr ColumnKind kind = column_kind<M>();
+				constexpr std::uint32_t width = column_width<M>();
+
+				// Not in the file (older schema): keep the default
+				const std::byte* column = in.column(name, kind, width);
+				if (!column) return;
+
+				for (std::size_t i = 0; i < n; ++i) {
+					if constexpr (kind == ColumnKind::Texture || kind == ColumnKind::String) {
+						std::uint32_t index = 0;
+						std::memcpy(&index, column + i * width, width);
+						const char* text = in.string(index);
+						if constexpr (kind == ColumnKind::Texture) get(values[i]) = *text ? assets::load_texture(text) : assets::TextureId{};
+						else get(values[i]) = text;
+					} else if constexpr (kind == ColumnKind::Bool) {
+						get(values[i]) = column[i] != std::byte{ 0 };
+					} else {
+						std::memcpy(&get(values[i]), column + i * width, width);
+					}
+				}
+			});
+
+			auto& pool = reg.template view<T>();
+			pool.components.reserve(pool.components.size() + n);
+			pool.entity_map.reserve(pool.entity_map.size() + n);
+			for (std::size_t i = 0; i < n; ++i) reg.add_component(entities[i], std::move(values[i]));
+		};
+		ops.version = [](Registry& reg, bool rescan) -> changes::Tick {
+			// Types change tracking can't compare count as always changed
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				auto& tracker = changes::track<T>(reg);
+				if (rescan) tracker.update(reg, changes::tick());
+				return tracker.version();
+			} else {
+				return changes::tick();
+			}
+		};
+		detail::register_component(ops);
+	}
+
+} // namespace me::serialize
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "mini-engine-raylib/ecs/type_id.hpp"
+
+#include <mini-ecs/registry.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace me::snapshot {
+
+	// Old -> new ids of entities that had to be re-created by a restore. Ids not in the map are unchanged.
+	class Remap {
+	public:
+		explicit Remap(const std::unordered_map<me::entity::entity_id, me::entity::entity_id>& ids) : m_ids(&ids) {}
+
+		me::entity::entity_id operator()(me::entity::entity_id e) const {
+			auto it = m_ids->find(e);
+			return it == m_ids->end() ? e : it->second;
+		}
+
+	private:
+		const std::unordered_map<me::entity::entity_id, me::entity::entity_id>* m_ids;
+	};
+
+	namespace detail {
+		// Type-erased access to one registered pool
+		struct PoolOps {
+			ComponentTypeId id = 0;
+			const char* name = "";
+			std::size_t size = 0;                                                           // sizeof(T)
+			std::span<me::entity::entity_id> (*entities)(Registry&) = nullptr;              // Pool's entity order
+			std::byte* (*components)(Registry&) = nullptr;                                   // Pool's component array
+			void (*add)(Registry&, me::entity::entity_id, const std::byte* value) = nullptr;
+			void (*remove)(Registry&, me::entity::entity_id) = nullptr;
+			void (*remap)(std::byte* value, const Remap& remap) = nullptr;                  // Fixes entity ids inside T
+		};
+
+		void register_pool(const PoolOps& ops);
+	} // namespace detail
+
+	// Adds T to the pools captured by snapshots. Engine components are registered already. `remap` (optional)
+	// rewrites entity ids stored inside T when a restore had to re-create the entities they point at.
+	template <typename T>
+	void register_type(void (*remap)(T& value, const Remap& remap) = nullptr) {
+		static_assert(std::is_trivially_copyable_v<T>, "Snapshots copy components with memcpy");
+
+		// The lambdas below stay captureless (plain function pointers), so the hook lives in a per-type static
+		static void (*s_remap)(T&, const Remap&) = nullptr;
+		s_remap = remap;
+
+		detail::PoolOps ops;
+		ops.id = component_type_id<T>();
+		ops.name = type_name<T>();
+		ops.size = sizeof(T);
+		ops.entities = [](Registry& reg) { auto& map = reg.template view<T>().entity_map; return std::span<me::entity::entity_id>(map.data(), map.size()); };
+		ops.components = [](Registry& reg) { return reinterpret_cast<std::byte*>(reg.template view<T>().components.data()); };
+		ops.add = [](Registry& reg, me::entity::entity_id e, const std::byte* value) {
+			T component;
+			std::memcpy(&component, value, sizeof(T));
+			reg.add_component(e, component);
+		};
+		ops.remove = [](Registry& reg, me::entity::entity_id e) { reg.template remove_component<T>(e); };
+		if (remap) ops.remap = [](std::byte* value, const Remap& ids) { s_remap(*reinterpret_cast<T*>(value), ids); };
+		detail::register_pool(ops);
+	}
+
+	// In-memory copy of every registered pool: for each, its entity order and raw component bytes, packed in one
+	// contiguous buffer. A delta snapshot stores only the 64-component blocks that differ from its base (pools whose
+	// entity order changed are stored whole). Not a file format: type ids are only stable within one run.
+	class Snapshot {
+	public:
+		bool empty() const { return m_pools.empty(); }
+		bool is_delta() const { return m_base != nullptr; }
+
+		std::size_t component_count() const { return m_component_count; }
+		std::size_t byte_size() const { return m_bytes.size(); }
+
+	private:
+		friend Snapshot capture(Registry& reg);
+		friend Snapshot capture_delta(Registry& reg, const Snapshot& base);
+		friend bool restore(Registry& reg, Snapshot& snapshot);
+
+		struct Pool {
+			ComponentTypeId id = 0;
+			std::size_t size = 0;              // sizeof(T)
+			std::size_t count = 0;             // Components
+			std::size_t entities = 0;          // Offset of count entity ids (full pools)
+			std::size_t components = 0;        // Offset of count * size bytes (full pools), or of the delta blocks
+			std::size_t blocks = 0;            // Delta pools: changed blocks, each a uint32 index then its bytes
+			bool delta = false;
+		};
+
+		std::vector<std::byte> m_bytes;
+		std::vector<Pool> m_pools;
+		std::size_t m_component_count = 0;
+		std::uint64_t m_layout = 0;            // Bumped when a restore re-lays the snapshot out
+		const Snapshot* m_base = nullptr;      // Delta snapshots only; must outlive this one
+		std::uint64_t m_base_layout = 0;       // base->m_layout the delta was taken against
+	};
+
+	// Full snapshot of every registered pool
+	Snapshot capture(Registry& reg);
+
+	// Only what changed since `base` (a full snapshot that must outlive the result and stay in place). A delta base
+	// falls back to a full capture.
+	Snapshot capture_delta(Registry& reg, const Snapshot& base);
+
+	// Puts every registered pool back to the snapshot. When the same entities still own the same components in the
+	// same order, each pool is one memcpy. Otherwise entities created since are destroyed, destroyed ones are
+	// re-created (new ids, remapped inside registered components), and components are added/removed to match;
+	// a full snapshot is then re-laid out to the resulting ids and pool order, so restoring it again is a memcpy
+	// (deltas taken against its old layout stop restoring). Entities that own none of the registered components are
+	// invisible to snapshots and left alone. False if the snapshot can't be applied.
+	bool restore(Registry& reg, Snapshot& snapshot);
+
+	// Last restore
+	struct Stats {
+		bool fast_path = false;                // Every pool restored with a plain memcpy
+		std::size_t destroyed = 0;
+		std::size_t recreated = 0;
+		std::size_t bytes = 0;                 // Component bytes copied
+	};
+
+	Stats stats();
+
+} // namespace me::snapshot
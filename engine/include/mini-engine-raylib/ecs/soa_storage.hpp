@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace me {
+
+	// Describes how a component splits into SoA fields. Specialize per type:
+	//   using scalar = float;                                    Every field has this type
+	//   static constexpr std::array<scalar T::*, N> fields;      Member pointers, one row per field
+	//   struct Ref { scalar& a; scalar& b; ... };                Named references into one element
+	//   template <typename Lane> static Ref make_ref(Lane&& lane) { return { lane(0), lane(1), ... }; }
+	template <typename T>
+	struct SoaLayout;
+
+	// Chunked structure-of-arrays storage. Elements are grouped in chunks of ChunkSize; inside a chunk every field
+	// is a contiguous row aligned for AVX, so SIMD kernels load 4/8 elements of one field per instruction instead
+	// of gathering strided members. Element access keeps the struct feel: `soa[i].x += 1.0f`.
+	template <typename T, std::size_t ChunkSize = 64>
+	class SoaChunks {
+		using Layout = SoaLayout<T>;
+
+	public:
+		using scalar = typename Layout::scalar;
+		using Ref = typename Layout::Ref;
+
+		static constexpr std::size_t chunk_size = ChunkSize;
+		static constexpr std::size_t field_count = Layout::fields.size();
+
+		static_assert(ChunkSize % 8 == 0, "Chunks must hold whole AVX vectors");
+
+		struct alignas(64) Chunk {
+			scalar rows[field_count][ChunkSize];
+		};
+
+		// Row index of a member, for field(): soa.field(c, SoaChunks::index_of(&T::x))
+		static consteval std::size_t index_of(scalar T::* member) {
+			for (std::size_t f = 0; f < field_count; ++f)
+				if (Layout::fields[f] == member) return f;
+			return field_count;
+		}
+
+		void resize(std::size_t n) {
+			m_size = n;
+			m_chunks.resize((n + ChunkSize - 1) / ChunkSize);
+		}
+
+		void clear() {
+			m_size = 0;
+			m_chunks.clear();
+		}
+
+		std::size_t size() const { return m_size; }
+		std::size_t chunk_count() const { return m_chunks.size(); }
+
+		// Elements in chunk c (ChunkSize except possibly the last one)
+		std::size_t chunk_length(std::size_t c) const {
+			const std::size_t begin = c * ChunkSize;
+			return m_size - begin < ChunkSize ? m_size - begin : ChunkSize;
+		}
+
+		Chunk& chunk(std::size_t c) { return m_chunks[c]; }
+		const Chunk& chunk(std::size_t c) const { return m_chunks[c]; }
+
+		// One field of chunk c: chunk_length(c) values, aligned to 64 bytes
+		scalar* field(std::size_t c, std::size_t f) { return m_chunks[c].rows[f]; }
+		const scalar* field(std::size_t c, std::size_t f) const { return m_chunks[c].rows[f]; }
+
+		Ref operator[](std::size_t i) {
+			Chunk& c = m_chunks[i / ChunkSize];
+			const std::size_t lane = i % ChunkSize;
+			return Layout::make_ref([&](std::size_t f) -> scalar& { return c.rows[f][lane]; });
+		}
+
+		T get(std::size_t i) const {
+			const Chunk& c = m_chunks[i / ChunkSize];
+			const std::size_t lane = i % ChunkSize;
+			T out{};
+			for (std::size_t f = 0; f < field_count; ++f) out.*Layout::fields[f] = c.rows[f][lane];
+			return out;
+		}
+
+		void set(std::size_t i, const T& value) {
+			Chunk& c = m_chunks[i / ChunkSize];
+			const std::size_t lane = i % ChunkSize;
+			for (std::size_t f = 0; f < field_count; ++f) c.rows[f][lane] = value.*Layout::fields[f];
+		}
+
+	private:
+		std::vector<Chunk> m_chunks;
+		std::size_t m_size = 0;
+	};
+
+} // namespace me
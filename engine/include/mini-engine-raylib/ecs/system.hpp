@@ -1,14 +1,83 @@
 #pragma once
 
+#include "mini-engine-raylib/ecs/type_id.hpp"
+
 #include <mini-ecs/registry.hpp>
 
+#include <typeinfo>
+#include <vector>
+
 namespace me {
 
+	// Component types a system reads/writes. Used by Scene to run non-conflicting systems in parallel.
+	struct SystemAccess {
+		struct Entry {
+			ComponentTypeId id = 0;
+			const char* name = "";
+			void (*ensure_pool)(Registry&) = nullptr; // Creates the pool up front so workers never insert one
+		};
+
+		std::vector<Entry> reads;
+		std::vector<Entry> writes;
+
+		// Undeclared access: runs alone, ordered against every other system
+		bool exclusive = true;
+
+		bool conflicts_with(const SystemAccess& other) const {
+			if (exclusive || other.exclusive) return true;
+
+			auto overlaps = [](const std::vector<Entry>& a, const std::vector<Entry>& b) {
+				for (const auto& x : a)
+					for (const auto& y : b)
+						if (x.id == y.id) return true;
+				return false;
+			};
+
+			return overlaps(writes, other.writes) || overlaps(writes, other.reads) || overlaps(reads, other.writes);
+		}
+	};
+
+	// Access descriptors: me::SystemWith<me::Read<Velocity>, me::Write<TransformComponent>>
+	template <typename... T> struct Read {};
+	template <typename... T> struct Write {};
+
+	namespace detail {
+		template <typename T>
+		SystemAccess::Entry access_entry() {
+			return { component_type_id<T>(), type_name<T>(), [](Registry& reg) { (void)reg.view<T>(); } };
+		}
+
+		template <template <typename...> class List, typename... T>
+		void append_access(std::vector<SystemAccess::Entry>& out, List<T...>*) { (out.push_back(access_entry<T>()), ...); }
+	}
+
+	template <typename ReadList, typename WriteList = Write<>>
+	SystemAccess make_access() {
+		SystemAccess access;
+		access.exclusive = false;
+		detail::append_access(access.reads, static_cast<ReadList*>(nullptr));
+		detail::append_access(access.writes, static_cast<WriteList*>(nullptr));
+		return access;
+	}
+
 	class System {
 	public:
 		virtual ~System() = default;
 
 		virtual void on_update(Registry& registry, float dt) = 0;
+
+		// Label used by profiler captures and schedule dumps (override for a readable name)
+		virtual const char* get_name() const { return type_name(typeid(*this)); }
+
+		// Components this system touches. Default: exclusive (never runs alongside another system).
+		virtual SystemAccess get_access() const { return {}; }
+	};
+
+	// Convenience base that declares access through template arguments
+	template <typename ReadList, typename WriteList = Write<>>
+	class SystemWith : public System {
+	public:
+		SystemAccess get_access() const override { return make_access<ReadList, WriteList>(); }
 	};
 
-} // namespace me
\ No newline at end of file
+} // namespace me
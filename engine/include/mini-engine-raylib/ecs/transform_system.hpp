@@ -0,0 +1,71 @@
+#pragma once
+
+#include "mini-engine-raylib/ecs/components.hpp"
+#include "mini-engine-raylib/ecs/soa_storage.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace me {
+
+	template <>
+	struct SoaLayout<me::components::TransformComponent> {
+		using T = me::components::TransformComponent;
+		using scalar = float;
+
+		static constexpr std::array<float T::*, 9> fields = { &T::x, &T::y, &T::z, &T::rot_x, &T::rot_y, &T::rot_z, &T::sx, &T::sy, &T::sz };
+
+		struct Ref {
+			float& x; float& y; float& z;
+			float& rot_x; float& rot_y; float& rot_z;
+			float& sx; float& sy; float& sz;
+		};
+
+		template <typename Lane>
+		static Ref make_ref(Lane&& lane) {
+			return { lane(0), lane(1), lane(2), lane(3), lane(4), lane(5), lane(6), lane(7), lane(8) };
+		}
+	};
+
+} // namespace me
+
+namespace me::transform {
+
+	// Transforms split into 64-entity SoA chunks (one aligned row per field)
+	using TransformSoa = me::SoaChunks<me::components::TransformComponent, 64>;
+
+	// Column-major 4x4: translate * rot_z * rot_y * rot_x * scale (the order render_world has always used)
+	struct Matrix {
+		float m[16];
+	};
+
+	// Rebuilds the cached world matrix of every TransformComponent whose value changed since the last update.
+	// Writing a transform is enough to mark it dirty; unchanged ones cost one compare. The engine updates the
+	// cache once per frame after on_update, and render_world, spatial and change ticks read it; transforms
+	// written later in the frame (e.g. in on_render) show up next frame. Call it to get fresh matrices sooner.
+	void update();
+
+	// Cached world matrix of the entity, nullptr without a TransformComponent. Valid until the next update().
+	const Matrix* world_matrix(me::entity::entity_id e);
+
+	// Makes child's TransformComponent local to parent's world transform. Returns false for a missing entity
+	// or when parent is child itself or one of its descendants.
+	bool set_parent(me::entity::entity_id child, me::entity::entity_id parent);
+
+	// Detaches child; its TransformComponent is world space again
+	void clear_parent(me::entity::entity_id child);
+
+	// SoA copy of every TransformComponent as of the last update(), indexed like the TransformComponent pool.
+	// For SIMD kernels that read a few fields of many transforms (positions, scales). Read-only: write the components.
+	const TransformSoa& soa();
+
+	struct Stats {
+		std::size_t transforms = 0;              // Cached matrices
+		std::size_t recomputed = 0;              // Dirty in the last update
+		std::size_t hierarchy_nodes = 0;         // Entities with a parent or children
+		std::size_t hierarchy_recomputed = 0;    // Of those, re-multiplied in the last update
+	};
+
+	Stats stats();
+
+} // namespace me::transform
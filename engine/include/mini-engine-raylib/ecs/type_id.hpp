@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <typeinfo>
+
+namespace me {
+
+	// Dense engine-side id per component type, assigned on first use (not stable across runs)
+	using ComponentTypeId = std::uint32_t;
+
+	namespace detail {
+		inline std::atomic<ComponentTypeId> s_next_component_type_id{ 0 };
+	}
+
+	template <typename T>
+	ComponentTypeId component_type_id() {
+		static const ComponentTypeId s_id = detail::s_next_component_type_id.fetch_add(1, std::memory_order_relaxed);
+		return s_id;
+	}
+
+	// Readable type name for debug output ("game::MoveSystem"): typeid names demangled where the compiler mangles
+	// them (GCC, Clang). Cached; the pointer stays valid for the whole run.
+	const char* type_name(const std::type_info& type);
+
+	template <typename T>
+	const char* type_name() {
+		static const char* s_name = type_name(typeid(T));
+		return s_name;
+	}
+
+} // namespace me
@@ -0,0 +1,264 @@
+#pragma once
+
+#include <mini-ecs/registry.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace me {
+
+	namespace detail {
+		template <typename T>
+		using pool_t = std::remove_reference_t<decltype(std::declval<Registry&>().template view<T>())>;
+
+		template <typename T, typename... Ts>
+		constexpr std::size_t index_of() {
+			constexpr bool matches[] = { std::is_same_v<T, Ts>... };
+			for (std::size_t i = 0; i < sizeof...(Ts); ++i)
+				if (matches[i]) return i;
+			return sizeof...(Ts);
+		}
+	} // namespace detail
+
+	// Entities that have every component in Ts. Iteration walks the smallest pool and resolves the others per
+	// entity, so it costs (smallest pool) lookups instead of (first pool). Yields std::tuple<entity_id, Ts&...>:
+	//   for (auto [e, t, mesh] : me::view<TransformComponent, MeshRendererComponent>(reg)) { ... }
+	// Component values may be changed while iterating, but components must not be added or removed.
+	template <typename... Ts>
+	class View {
+		static_assert(sizeof...(Ts) > 0, "View needs at least one component type");
+
+	public:
+		using value_type = std::tuple<me::entity::entity_id, Ts&...>;
+
+		explicit View(Registry& reg) : m_reg(&reg), m_pools(&reg.template view<Ts>()...) {
+			pick_driver(std::index_sequence_for<Ts...>{});
+		}
+
+		class iterator {
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = View::value_type;
+			using difference_type = std::ptrdiff_t;
+
+			iterator() = default;
+			iterator(const View* view, std::size_t slot) : m_view(view), m_slot(slot) { settle(); }
+
+			value_type operator*() const { return std::tuple_cat(std::make_tuple(m_entity), std::apply([](auto*... c) { return std::tie(*c...); }, m_current)); }
+
+			iterator& operator++() {
+				++m_slot;
+				settle();
+				return *this;
+			}
+
+			iterator operator++(int) {
+				iterator old = *this;
+				++*this;
+				return old;
+			}
+
+			bool operator==(const iterator& other) const { return m_slot == other.m_slot; }
+
+		private:
+			// Moves to the first driver slot at or after m_slot whose entity has every component
+			void settle() {
+				const std::size_t end = m_view->size_hint();
+				for (; m_slot < end; ++m_slot)
+					if (m_view->resolve(m_slot, m_entity, m_current)) return;
+			}
+
+			const View* m_view = nullptr;
+			std::size_t m_slot = 0;
+			me::entity::entity_id m_entity{};
+			std::tuple<Ts*...> m_current{};
+		};
+
+		iterator begin() const { return iterator(this, 0); }
+		iterator end() const { return iterator(this, size_hint()); }
+
+		// Calls fn(entity, Ts&...) for every match
+		template <typename Fn>
+		void each(Fn&& fn) const {
+			me::entity::entity_id e{};
+			std::tuple<Ts*...> current{};
+			const std::size_t n = size_hint();
+			for (std::size_t slot = 0; slot < n; ++slot) {
+				if (resolve(slot, e, current)) std::apply([&](auto*... c) { fn(e, *c...); }, current);
+			}
+		}
+
+		// Upper bound on the number of matches: the size of the driving pool
+		std::size_t size_hint() const { return m_driver_size; }
+
+	private:
+		template <std::size_t... I>
+		void pick_driver(std::index_sequence<I...>) {
+			const std::size_t sizes[] = { std::get<I>(m_pools)->size()... };
+			m_driver = static_cast<std::size_t>(std::min_element(std::begin(sizes), std::end(sizes)) - std::begin(sizes));
+			m_driver_size = sizes[m_driver];
+			((I == m_driver ? (m_driver_entities = std::get<I>(m_pools)->entity_map.data(), 0) : 0), ...);
+		}
+
+		template <std::size_t I>
+		auto* component(std::size_t slot, me::entity::entity_id e) const {
+			using T = std::tuple_element_t<I, std::tuple<Ts...>>;
+			auto* pool = std::get<I>(m_pools);
+			return I == m_driver ? &pool->components[slot] : m_reg->template try_get_component<T>(e);
+		}
+
+		template <std::size_t... I>
+		bool resolve(std::size_t slot, me::entity::entity_id& e, std::tuple<Ts*...>& out, std::index_sequence<I...>) const {
+			e = m_driver_entities[slot];
+			return (((std::get<I>(out) = component<I>(slot, e)) != nullptr) && ...);
+		}
+
+		// Entity at `slot` of the driving pool and its components. False if one is missing.
+		bool resolve(std::size_t slot, me::entity::entity_id& e, std::tuple<Ts*...>& out) const {
+			return resolve(slot, e, out, std::index_sequence_for<Ts...>{});
+		}
+
+		Registry* m_reg;
+		std::tuple<detail::pool_t<Ts>*...> m_pools;
+		std::size_t m_driver = 0;
+		std::size_t m_driver_size = 0;
+		const me::entity::entity_id* m_driver_entities = nullptr;
+	};
+
+	template <typename... Ts>
+	View<Ts...> view(Registry& reg) {
+		return View<Ts...>(reg);
+	}
+
+	// Grouped join: keeps the matching pool slots of every Ts as one table, ordered like the first pool, so a
+	// pass over it is a linear walk without per-entity lookups. refresh() compares each pool's entity order with
+	// the one the table was built from and rebuilds only when a pool gained, lost or reordered entities.
+	// Random access by index makes it suitable for me::jobs::parallel_for_chunks.
+	template <typename... Ts>
+	class Group {
+		static_assert(sizeof...(Ts) > 0, "Group needs at least one component type");
+		static constexpr std::size_t N = sizeof...(Ts);
+
+	public:
+		using value_type = std::tuple<me::entity::entity_id, Ts&...>;
+
+		// Revalidates (and if needed rebuilds) the table. Not thread-safe; call before handing it to workers.
+		void refresh(Registry& reg) {
+			m_pools = std::make_tuple(&reg.template view<Ts>()...);
+			if (m_owner == &reg && unchanged(std::index_sequence_for<Ts...>{})) return;
+
+			m_owner = &reg;
+			rebuild(reg, std::index_sequence_for<Ts...>{});
+			++m_version;
+		}
+
+		std::size_t size() const { return m_entities.size(); }
+		me::entity::entity_id entity(std::size_t k) const { return m_entities[k]; }
+
+		// Component T of the k-th match
+		template <typename T>
+		T& get(std::size_t k) const {
+			constexpr std::size_t i = detail::index_of<T, Ts...>();
+			static_assert(i < N, "T is not part of this group");
+			return std::get<i>(m_pools)->components[m_slots[k][i]];
+		}
+
+		// Pool slot of T for the k-th match (e.g. to index data kept per pool slot)
+		template <typename T>
+		std::size_t slot(std::size_t k) const {
+			constexpr std::size_t i = detail::index_of<T, Ts...>();
+			static_assert(i < N, "T is not part of this group");
+			return m_slots[k][i];
+		}
+
+		value_type operator[](std::size_t k) const { return value_type(m_entities[k], get<Ts>(k)...); }
+
+		// Calls fn(entity, Ts&...) for every match
+		template <typename Fn>
+		void each(Fn&& fn) const {
+			for (std::size_t k = 0; k < m_entities.size(); ++k) fn(m_entities[k], get<Ts>(k)...);
+		}
+
+		class iterator {
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = Group::value_type;
+			using difference_type = std::ptrdiff_t;
+
+			iterator() = default;
+			iterator(const Group* group, std::size_t k) : m_group(group), m_k(k) {}
+
+			value_type operator*() const { return (*m_group)[m_k]; }
+			iterator& operator++() { ++m_k; return *this; }
+			iterator operator++(int) { iterator old = *this; ++m_k; return old; }
+			bool operator==(const iterator& other) const { return m_k == other.m_k; }
+
+		private:
+			const Group* m_group = nullptr;
+			std::size_t m_k = 0;
+		};
+
+		iterator begin() const { return iterator(this, 0); }
+		iterator end() const { return iterator(this, size()); }
+
+		// Bumped on every rebuild, so callers can cache data per row
+		std::uint64_t version() const { return m_version; }
+
+	private:
+		template <std::size_t... I>
+		bool unchanged(std::index_sequence<I...>) const {
+			return (std::equal(std::get<I>(m_pools)->entity_map.begin(), std::get<I>(m_pools)->entity_map.end(), m_order[I].begin(), m_order[I].end()) && ...);
+		}
+
+		template <std::size_t... I>
+		void rebuild(Registry& reg, std::index_sequence<I...>) {
+			m_entities.clear();
+			m_slots.clear();
+
+			View<Ts...>(reg).each([&](me::entity::entity_id e, Ts&... c) {
+				m_entities.push_back(e);
+				m_slots.push_back({ static_cast<std::uint32_t>(&c - std::get<I>(m_pools)->components.data())... });
+			});
+
+			// First pool's order, so at least that pool is walked front to back
+			std::vector<std::size_t> order(m_entities.size());
+			for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+			std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return m_slots[a][0] < m_slots[b][0]; });
+
+			std::vector<me::entity::entity_id> entities(order.size());
+			std::vector<std::array<std::uint32_t, N>> slots(order.size());
+			for (std::size_t i = 0; i < order.size(); ++i) {
+				entities[i] = m_entities[order[i]];
+				slots[i] = m_slots[order[i]];
+			}
+			m_entities = std::move(entities);
+			m_slots = std::move(slots);
+
+			(m_order[I].assign(std::get<I>(m_pools)->entity_map.begin(), std::get<I>(m_pools)->entity_map.end()), ...);
+		}
+
+		const Registry* m_owner = nullptr;
+		std::tuple<detail::pool_t<Ts>*...> m_pools{};
+		std::array<std::vector<me::entity::entity_id>, N> m_order;    // Each pool's entity_map at the last rebuild
+		std::vector<me::entity::entity_id> m_entities;
+		std::vector<std::array<std::uint32_t, N>> m_slots;
+		std::uint64_t m_version = 0;
+	};
+
+	// The shared Group for Ts, refreshed against reg. Call from the main thread (not from me::jobs workers).
+	template <typename... Ts>
+	Group<Ts...>& group(Registry& reg) {
+		static Group<Ts...> s_group;
+		s_group.refresh(reg);
+		return s_group;
+	}
+
+} // namespace me
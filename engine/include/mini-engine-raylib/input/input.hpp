@@ -28,7 +28,8 @@ namespace me::input {
 		MouseWheel   // wheel delta (usually vertical) per frame
 	};
 
-	// Called once per frame by the engine
+	// Called once per frame by the engine: snapshots the platform's input state.
+	// Every query below reads that snapshot (or the replayed one, see me::replay).
 	void poll();
 
 	void lock_cursor();
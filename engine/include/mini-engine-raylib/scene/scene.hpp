@@ -2,6 +2,7 @@
 
 #include "mini-engine-raylib/core/engine.hpp"
 #include "mini-engine-raylib/render/color.hpp"
+#include "mini-engine-raylib/ecs/changes.hpp"
 #include "mini-engine-raylib/ecs/system.hpp"
 
 #include <string>
@@ -23,9 +24,21 @@ namespace me {
 		virtual const char* get_file() const { return ""; }
 		virtual me::Color get_clear_color() const { return me::Color{ 0, 0, 0, 255 }; }
 
+		// True to allow scene_manager::restart(). load() then keeps a snapshot of every registered pool (one extra
+		// copy of the world) taken right after the file loaded. The restore only sees entities that own a
+		// snapshot-registered component (snapshot::register_type), so on_exit must destroy any others on_enter made.
+		virtual bool can_restart() const { return false; }
+
+		// True to make has_unsaved_changes() work. Each save/load then keeps a change tracker on every saved
+		// component type (a shadow copy of each pool, except Transform), so it is off by default.
+		virtual bool tracks_unsaved_changes() const { return false; }
+
+		// Systems run in registration order, except that systems whose declared access
+		// doesn't conflict (see System::get_access) may run at the same time on worker threads.
 		template <typename T, typename... Args>
 		void add_system(Args&&... args) {
 			m_systems.push_back(std::make_unique<T>(std::forward<Args>(args)...));
+			m_schedule.clear();
 		}
 
 		// Lifecycle hooks
@@ -34,23 +47,43 @@ namespace me {
 
 		virtual void on_exit() {
 			m_systems.clear();
+			m_schedule.clear();
 		}
 
-		virtual void on_update(float dt) {
-			auto& reg = me::get_registry();
-
-			for (auto& sys : m_systems)
-				sys->on_update(reg, dt);
-		}
+		virtual void on_update(float dt);
 
 		virtual void on_resize(int width, int height) {}
 
-		// Saves/Loads this scene's entities to/from its JSON file
+		// Saves/Loads this scene's entities to/from scenes/<get_file()> (see scene_file.hpp). Loading prefers a
+		// cooked .mescene next to the JSON file unless the JSON is newer.
 		bool save_to_file() const;
 		bool load_from_file() const;
 
+		// True when a saved component type was added, written or removed since the
+		// last save_to_file()/load_from_file(). Cheap enough to poll for autosave.
+		// Always false unless tracks_unsaved_changes() is.
+		bool has_unsaved_changes() const;
+
+		// Human-readable system schedule: stage, dependencies and declared access of each system
+		std::string dump_schedule() const;
+
 	protected:
 		std::vector<std::unique_ptr<System>> m_systems;
+
+	private:
+		struct ScheduledSystem {
+			SystemAccess access;
+			std::vector<std::size_t> after;  // Earlier systems this one conflicts with
+			int stage = 0;                   // Longest dependency chain before it
+		};
+
+		std::vector<ScheduledSystem> build_schedule() const;
+
+		// Primes the change trackers of the saved component types (if tracked); only later writes count as unsaved
+		void mark_saved() const;
+
+		std::vector<ScheduledSystem> m_schedule; // Rebuilt whenever m_systems changes size
+		mutable changes::Tick m_saved_tick = 0;  // changes::tick() at the last save/load (0 = never)
 	};
 
 	// ===================================================================
@@ -59,6 +92,7 @@ namespace me {
 	namespace scene_manager {
 		void register_scene(Scene* scene);        // Registers a level
 		void load(const std::string& name);       // Switches the active level
+		bool restart();                           // Back to the active level's state right after its file loaded (snapshot, no JSON); see Scene::can_restart
 		void exit();
 		void update(float dt);                    // Updates the active level
 		void resize(int width, int height);
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace me::scene_file {
+
+	// Scene files hold the entities of the engine registry that own a TransformComponent, with every component in
+	// serialize::components() plus ParentComponent (linked through transform::set_parent on load). Loading adds
+	// to the registry; it doesn't clear it.
+	//
+	// JSON (.json) is the authoring format. It is streamed both ways: saving writes each entity as it is visited
+	// and loading creates entities and components as the parser reaches them, so neither builds a document of the
+	// whole scene. The binary format (.mescene) is the shipping one: each pool is stored as one column block per
+	// field, so loading is a bulk copy per column instead of a parse per entity. The file is memory-mapped and
+	// uncompressed blocks are read in place.
+
+	// Written by save_binary; load_binary refuses other versions
+	inline constexpr std::uint32_t k_binary_version = 1;
+	inline constexpr const char* k_binary_extension = ".mescene";
+
+	struct BinaryOptions {
+		bool compress = true;   // LZ-compress each block that shrinks by at least 1/8
+	};
+
+	bool save_json(const std::filesystem::path& path);
+	bool load_json(const std::filesystem::path& path);
+
+	bool save_binary(const std::filesystem::path& path, const BinaryOptions& options = {});
+	bool load_binary(const std::filesystem::path& path);
+
+	// Picks the format from the extension (.mescene = binary, anything else = JSON)
+	bool save(const std::filesystem::path& path, const BinaryOptions& options = {});
+	bool load(const std::filesystem::path& path);
+
+	// The last successful load or save, either format
+	struct Stats {
+		std::size_t entities = 0;
+		std::size_t bytes = 0;       // File size
+		double seconds = 0.0;
+		bool binary = false;
+
+		double entities_per_second() const { return seconds > 0.0 ? static_cast<double>(entities) / seconds : 0.0; }
+	};
+
+	Stats load_stats();
+	Stats save_stats();
+
+	// JSON <-> binary, by extension. Loads `in` into the engine registry, saves `out` (everything in the registry,
+	// so call it on an empty one, as scene_convert does), then destroys what it loaded.
+	bool convert(const std::filesystem::path& in, const std::filesystem::path& out, const BinaryOptions& options = {});
+
+} // namespace me::scene_file
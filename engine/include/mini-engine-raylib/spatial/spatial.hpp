@@ -0,0 +1,70 @@
+#pragma once
+
+#include "mini-engine-raylib/core/math.hpp"
+#include "mini-engine-raylib/ecs/components.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+// Spatial queries over every entity with a TransformComponent. Bounds are the world-space box of the engine's
+// unit primitives (-1..1 on each axis) under the entity's world matrix, so they follow position, rotation, scale
+// and parents. The tree is refreshed once per frame (after Application::on_update); queries see that state.
+// Queries only read the tree and may run on any thread, including me::jobs workers.
+namespace me::spatial {
+
+	struct Aabb {
+		me::math::Vec3 min;
+		me::math::Vec3 max;
+	};
+
+	// Points p with dot(normal, p) + d >= 0 are inside
+	struct Plane {
+		me::math::Vec3 normal;
+		float d = 0.0f;
+	};
+
+	struct Ray {
+		me::math::Vec3 origin;
+		me::math::Vec3 direction;                                      // Needn't be normalized
+		float max_distance = std::numeric_limits<float>::infinity();
+	};
+
+	struct RayHit {
+		me::entity::entity_id entity = 0;
+		float distance = 0.0f;                                         // Along the normalized direction, 0 if the origin is inside
+	};
+
+	// Syncs the tree with the registry: new, moved and destroyed transforms. Moves within a small margin cost
+	// nothing; when many bounds changed the tree is rebuilt instead of updated leaf by leaf. The engine calls
+	// this every frame once any spatial function was used; call it yourself to see this frame's changes, from the
+	// thread that runs the frame (not from a job). Queries from jobs it waits on are fine.
+	void update();
+
+	// Closest entity whose bounds the ray hits within max_distance
+	bool raycast(const Ray& ray, RayHit& hit);
+
+	// Entities whose bounds intersect the volume. Results replace the contents of `out`; returns their count.
+	std::size_t query_box(const Aabb& box, std::vector<me::entity::entity_id>& out);
+	std::size_t query_sphere(const me::math::Vec3& center, float radius, std::vector<me::entity::entity_id>& out);
+
+	// Convex volume given by inward-facing planes, e.g. a camera frustum's six. Conservative near edges and corners.
+	std::size_t query_planes(std::span<const Plane> planes, std::vector<me::entity::entity_id>& out);
+
+	// Up to k entities closest to the point (distance to their bounds), nearest first
+	std::size_t query_nearest(const me::math::Vec3& point, std::size_t k, std::vector<me::entity::entity_id>& out);
+
+	struct Stats {
+		std::size_t proxies = 0;       // Entities in the tree
+		std::size_t nodes = 0;
+		int height = 0;
+		std::size_t inserted = 0;      // In the last update
+		std::size_t moved = 0;         // Left their margin in the last update
+		std::size_t removed = 0;
+		bool rebuilt = false;          // Last update rebuilt the whole tree
+	};
+
+	Stats stats();
+
+} // namespace me::spatial
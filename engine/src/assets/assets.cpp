@@ -2,8 +2,12 @@
 #include "mini-engine-raylib/core/math.hpp"
 #include "mini-engine-raylib/core/engine.hpp" 
 #include "mini-engine-raylib/ecs/components.hpp"
+#include "assets_internal.hpp"
+#include "../platform/platform.hpp"
 
+#if ME_HAS_RAYLIB
 #include <raylib.h>
+#endif
 
 #include <unordered_map>
 #include <unordered_set>
@@ -18,7 +22,11 @@ namespace me::assets {
 
 	namespace {
 		struct TexRecord {
-			::Texture2D tex{};
+#if ME_HAS_RAYLIB
+			::Texture2D tex{}; // Stays empty when headless
+#endif
+			int width = 0;
+			int height = 0;
 			int refs = 0;
 			std::uint32_t handle = 0;
 		};
@@ -29,15 +37,26 @@ namespace me::assets {
 		std::unordered_map<std::uint32_t, std::string> s_handle_to_path;
 		std::uint32_t s_next_handle = 1;
 
-		static std::string full_path(const char* uri) {
-			if (!uri || !*uri) return {};
-			if (!s_base.empty())
-				return s_base + uri;
-			return std::string(uri);
+
+		static void unload_gpu(TexRecord& rec) {
+#if ME_HAS_RAYLIB
+			if (rec.tex.id != 0) UnloadTexture(rec.tex);
+			rec.tex = {};
+#else
+			(void)rec;
+#endif
 		}
 	} // namespace
 
+	std::string internal_asset_path(const char* uri) {
+		if (!uri || !*uri) return {};
+		if (!s_base.empty())
+			return s_base + uri;
+		return std::string(uri);
+	}
+
 	// ---- internal access for Render2D/3D ----
+#if ME_HAS_RAYLIB
 	const ::Texture2D* internal_get_texture(TextureId id) {
 		if (id.handle == 0) return nullptr;
 		auto itPath = s_handle_to_path.find(id.handle);
@@ -46,6 +65,7 @@ namespace me::assets {
 		if (itRec == s_by_path.end()) return nullptr;
 		return &itRec->second.tex;
 	}
+#endif
 
 	const char* internal_get_texture_path(TextureId id) {
 		if (id.handle == 0) return nullptr;
@@ -65,6 +85,44 @@ namespace me::assets {
 		fs::create_directories(full);
 	}
 
+	TextureId internal_add_texture(const char* key, const std::uint8_t* rgba, int width, int height, bool mipmaps) {
+		TextureId out{};
+		if (!key || !*key) return out;
+
+		auto it = s_by_path.find(key);
+		if (it != s_by_path.end()) {
+			it->second.refs += 1;
+			out.handle = it->second.handle;
+			return out;
+		}
+
+		TexRecord rec{};
+		rec.width = width;
+		rec.height = height;
+
+#if ME_HAS_RAYLIB
+		if (!me::platform::is_headless() && rgba != nullptr) {
+			::Image img{ const_cast<std::uint8_t*>(rgba), width, height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+			rec.tex = LoadTextureFromImage(img);
+			if (mipmaps) {
+				GenTextureMipmaps(&rec.tex);
+				SetTextureFilter(rec.tex, TEXTURE_FILTER_TRILINEAR);
+			}
+		}
+#else
+		(void)rgba;
+		(void)mipmaps;
+#endif
+
+		rec.refs = 1;
+		rec.handle = s_next_handle++;
+		s_by_path.emplace(key, rec);
+
+		out.handle = rec.handle;
+		s_handle_to_path[out.handle] = key;
+		return out;
+	}
+
 	TextureId load_texture(const char* uri) {
 		TextureId out{};
 		if (!uri || !*uri) return out;
@@ -72,16 +130,23 @@ namespace me::assets {
 		const std::string key = uri;
 		auto it = s_by_path.find(key);
 		if (it == s_by_path.end()) {
-			const std::string path = full_path(uri);
-			::Image img = LoadImage(path.c_str());
-			if (img.data == nullptr) {
-				return out;
+			TexRecord rec{};
+
+#if ME_HAS_RAYLIB
+			// Headless: keep the handle bookkeeping but never touch the disk or the GPU
+			if (!me::platform::is_headless()) {
+				const std::string path = internal_asset_path(uri);
+				::Image img = LoadImage(path.c_str());
+				if (img.data == nullptr) {
+					return out;
+				}
+				rec.tex = LoadTextureFromImage(img);
+				rec.width = rec.tex.width;
+				rec.height = rec.tex.height;
+				UnloadImage(img);
 			}
-			::Texture2D tex = LoadTextureFromImage(img);
-			UnloadImage(img);
+#endif
 
-			TexRecord rec{};
-			rec.tex = tex;
 			rec.refs = 1;
 			rec.handle = s_next_handle++;
 
@@ -116,7 +181,7 @@ namespace me::assets {
 
 		itRec->second.refs -= 1;
 		if (itRec->second.refs <= 0) {
-			UnloadTexture(itRec->second.tex);
+			unload_gpu(itRec->second);
 			s_by_path.erase(itRec);
 		}
 
@@ -125,11 +190,12 @@ namespace me::assets {
 
 	void release_all() {
 		for (auto& kv : s_by_path)
-			UnloadTexture(kv.second.tex);
+			unload_gpu(kv.second);
 
 		s_by_path.clear();
 		s_handle_to_path.clear();
 		s_next_handle = 1;
+		internal_clear_atlases();
 	}
 
 	void release_unused() {}
@@ -142,12 +208,19 @@ namespace me::assets {
 		return itRec != s_by_path.end();
 	}
 
+	const char* texture_uri(TextureId id) {
+		return internal_get_texture_path(id);
+	}
+
 	me::math::Vec2 texture_size(TextureId id) {
 		me::math::Vec2 sz{};
-		auto* tex = internal_get_texture(id);
-		if (!tex) return sz;
-		sz.x = static_cast<float>(tex->width);
-		sz.y = static_cast<float>(tex->height);
+		if (id.handle == 0) return sz;
+		auto itPath = s_handle_to_path.find(id.handle);
+		if (itPath == s_handle_to_path.end()) return sz;
+		auto itRec = s_by_path.find(itPath->second);
+		if (itRec == s_by_path.end()) return sz;
+		sz.x = static_cast<float>(itRec->second.width);
+		sz.y = static_cast<float>(itRec->second.height);
 		return sz;
 	}
 
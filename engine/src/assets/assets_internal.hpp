@@ -2,14 +2,31 @@
 
 #include "mini-engine-raylib/assets/assets.hpp"
 
+#include <cstdint>
+#include <string>
+
+#if ME_HAS_RAYLIB
 #include <raylib.h>
+#endif
 
 namespace me::assets {
 
+#if ME_HAS_RAYLIB
 	// Internal-only: let Render2D access the loaded Texture2D
 	const ::Texture2D* internal_get_texture(TextureId id);
+#endif
+
+	// Resolves a URI against the asset root
+	std::string internal_asset_path(const char* uri);
 
 	// Returns the original URI/key used to load this texture, or nullptr if unknown.
 	const char* internal_get_texture_path(TextureId id);
 
+	// Internal-only: registers an RGBA8 image that is already in memory (e.g. a packed atlas) under `key`,
+	// with one reference. Uploads it unless headless or `rgba` is null. Returns the existing handle if `key` is loaded.
+	TextureId internal_add_texture(const char* key, const std::uint8_t* rgba, int width, int height, bool mipmaps);
+
+	// Internal-only: forgets every atlas (their textures are released separately). Called by release_all().
+	void internal_clear_atlases();
+
 } // namespace me::assets
\ No newline at end of file
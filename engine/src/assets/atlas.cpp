@@ -0,0 +1,288 @@
+#include "mini-engine-raylib/assets/assets.hpp"
+#include "assets_internal.hpp"
+#include "atlas_packer.hpp"
+
+#if ME_HAS_RAYLIB
+#include <raylib.h>
+#endif
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+namespace me::assets {
+
+	namespace {
+		struct Region {
+			int x = 0, y = 0, width = 0, height = 0;
+		};
+
+		struct Atlas {
+			TextureId texture{};
+			int width = 0, height = 0;
+			std::unordered_map<std::string, Region> regions;
+		};
+
+		// Decoded RGBA8 source image
+		struct Source {
+			std::string name;
+			std::string path;
+			int width = 0, height = 0;
+			std::vector<std::uint8_t> pixels;
+		};
+
+		struct Packed {
+			int width = 0, height = 0;
+			std::vector<PackRect> rects;     // Same order as the sources
+			std::vector<std::uint8_t> pixels;
+		};
+
+		constexpr const char* k_atlas_suffix = ".atlas.json";
+		constexpr int k_atlas_version = 1;
+
+		std::unordered_map<std::uint32_t, Atlas> s_atlases;
+		std::uint32_t s_next_atlas = 1;
+
+		std::string strip_extension(const fs::path& p) {
+			return (p.parent_path() / p.stem()).generic_string();
+		}
+
+		bool is_image(const fs::path& p) {
+			std::string ext = p.extension().string();
+			std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+			return ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp" || ext == ".tga" || ext == ".gif" || ext == ".qoi";
+		}
+
+		// Images under `folder` (recursive), relative to it and sorted so the layout is stable between runs
+		std::vector<fs::path> list_images(const fs::path& folder) {
+			std::vector<fs::path> out;
+			std::error_code ec;
+			for (const auto& entry : fs::recursive_directory_iterator(folder, ec)) {
+				if (entry.is_regular_file() && is_image(entry.path()))
+					out.push_back(entry.path().lexically_relative(folder));
+			}
+			std::sort(out.begin(), out.end());
+			return out;
+		}
+
+		bool read_image(Source& src) {
+#if ME_HAS_RAYLIB
+			::Image img = LoadImage(src.path.c_str());
+			if (img.data == nullptr) return false;
+
+			ImageFormat(&img, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+			src.width = img.width;
+			src.height = img.height;
+
+			const auto* pixels = static_cast<const std::uint8_t*>(img.data);
+			src.pixels.assign(pixels, pixels + static_cast<std::size_t>(img.width) * img.height * 4);
+			UnloadImage(img);
+			return true;
+#else
+			(void)src;
+			return false;
+#endif
+		}
+
+		bool pack(std::vector<Source>& sources, const AtlasOptions& options, Packed& out) {
+			for (Source& src : sources) {
+				if (!read_image(src)) {
+					std::cerr << "Atlas: failed to read image: " << src.path << "\n";
+					return false;
+				}
+			}
+
+			out.rects.resize(sources.size());
+			for (std::size_t i = 0; i < sources.size(); ++i)
+				out.rects[i] = { sources[i].width, sources[i].height };
+
+			if (!internal_pack_skyline(out.rects, options.padding, options.max_size, out.width, out.height)) {
+				std::cerr << "Atlas: images don't fit in " << options.max_size << "x" << options.max_size << "\n";
+				return false;
+			}
+
+			out.pixels.assign(static_cast<std::size_t>(out.width) * out.height * 4, 0);
+			for (std::size_t i = 0; i < sources.size(); ++i) {
+				const PackRect& r = out.rects[i];
+				internal_blit_rgba(out.pixels.data(), out.width, sources[i].pixels.data(), r.width, r.height, r.x, r.y, options.padding, options.extrude);
+			}
+			return true;
+		}
+
+		AtlasId add_atlas(Atlas atlas) {
+			AtlasId id{ s_next_atlas++ };
+			s_atlases.emplace(id.handle, std::move(atlas));
+			return id;
+		}
+
+		// Packs at runtime and registers the result as texture "atlas:<key>"
+		AtlasId pack_sources(const std::string& key, std::vector<Source>& sources, const AtlasOptions& options) {
+			Packed packed;
+			if (sources.empty() || !pack(sources, options, packed)) return {};
+
+			Atlas atlas;
+			atlas.width = packed.width;
+			atlas.height = packed.height;
+			for (std::size_t i = 0; i < sources.size(); ++i) {
+				const PackRect& r = packed.rects[i];
+				atlas.regions[sources[i].name] = { r.x, r.y, r.width, r.height };
+			}
+
+			const std::string texture_key = "atlas:" + key;
+			atlas.texture = internal_add_texture(texture_key.c_str(), packed.pixels.data(), packed.width, packed.height, options.mipmaps);
+			return add_atlas(std::move(atlas));
+		}
+
+		AtlasId load_cooked(const char* uri, const fs::path& meta_path) {
+			std::ifstream file(meta_path);
+			json root = json::parse(file, nullptr, false);
+			if (root.is_discarded() || root.value("version", 0) != k_atlas_version) {
+				std::cerr << "Atlas: invalid file: " << meta_path.string() << "\n";
+				return {};
+			}
+
+			Atlas atlas;
+			atlas.width = root.value("width", 0);
+			atlas.height = root.value("height", 0);
+			for (const auto& [name, rect] : root["regions"].items()) {
+				if (!rect.is_array() || rect.size() != 4) continue;
+				atlas.regions[name] = { rect[0].get<int>(), rect[1].get<int>(), rect[2].get<int>(), rect[3].get<int>() };
+			}
+
+			// The texture sits next to the metadata
+			const std::string texture_uri = (fs::path(uri).parent_path() / root.value("texture", std::string{})).generic_string();
+			atlas.texture = load_texture(texture_uri.c_str());
+			if (atlas.texture.handle == 0) {
+				std::cerr << "Atlas: failed to load texture: " << texture_uri << "\n";
+				return {};
+			}
+			return add_atlas(std::move(atlas));
+		}
+	} // namespace
+
+	AtlasId load_atlas(const char* uri, const AtlasOptions& options) {
+		if (!uri || !*uri) return {};
+
+		const std::string base = internal_asset_path(uri);
+		const fs::path meta_path = base + k_atlas_suffix;
+		if (fs::exists(meta_path)) return load_cooked(uri, meta_path);
+
+		// Not cooked: pack the folder now
+		if (!fs::is_directory(base)) {
+			std::cerr << "Atlas not found: " << base << "\n";
+			return {};
+		}
+
+		std::vector<Source> sources;
+		for (const fs::path& rel : list_images(base)) {
+			Source src;
+			src.name = strip_extension(rel);
+			src.path = (fs::path(base) / rel).string();
+			sources.push_back(std::move(src));
+		}
+		return pack_sources(uri, sources, options);
+	}
+
+	AtlasId pack_atlas(const char* name, const std::vector<std::string>& uris, const AtlasOptions& options) {
+		if (!name || !*name) return {};
+
+		std::vector<Source> sources;
+		for (const std::string& uri : uris) {
+			Source src;
+			src.name = strip_extension(uri);
+			src.path = internal_asset_path(uri.c_str());
+			sources.push_back(std::move(src));
+		}
+		return pack_sources(name, sources, options);
+	}
+
+	bool cook_atlas(const char* folder, const char* out_base, const AtlasOptions& options) {
+		if (!folder || !*folder || !out_base || !*out_base) return false;
+
+		std::vector<Source> sources;
+		for (const fs::path& rel : list_images(folder)) {
+			Source src;
+			src.name = strip_extension(rel);
+			src.path = (fs::path(folder) / rel).string();
+			sources.push_back(std::move(src));
+		}
+
+		Packed packed;
+		if (sources.empty() || !pack(sources, options, packed)) return false;
+
+		const fs::path png_path = std::string(out_base) + ".png";
+		if (png_path.has_parent_path()) fs::create_directories(png_path.parent_path());
+
+#if ME_HAS_RAYLIB
+		::Image img{ packed.pixels.data(), packed.width, packed.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+		if (!ExportImage(img, png_path.string().c_str())) return false;
+#else
+		return false;
+#endif
+
+		json root;
+		root["version"] = k_atlas_version;
+		root["texture"] = png_path.filename().string();
+		root["width"] = packed.width;
+		root["height"] = packed.height;
+		root["padding"] = options.padding;
+
+		json regions = json::object();
+		for (std::size_t i = 0; i < sources.size(); ++i) {
+			const PackRect& r = packed.rects[i];
+			regions[sources[i].name] = { r.x, r.y, r.width, r.height };
+		}
+		root["regions"] = std::move(regions);
+
+		std::ofstream file(std::string(out_base) + k_atlas_suffix);
+		file << root.dump(2);
+		return static_cast<bool>(file);
+	}
+
+	AtlasRegion atlas_region(AtlasId atlas, const char* name) {
+		AtlasRegion out{};
+		if (!name) return out;
+
+		auto it = s_atlases.find(atlas.handle);
+		if (it == s_atlases.end()) return out;
+
+		const Atlas& a = it->second;
+		auto itRegion = a.regions.find(name);
+		if (itRegion == a.regions.end() || a.width <= 0 || a.height <= 0) return out;
+
+		const Region& r = itRegion->second;
+		const float inv_w = 1.0f / static_cast<float>(a.width);
+		const float inv_h = 1.0f / static_cast<float>(a.height);
+
+		out.texture = a.texture;
+		out.uv = { r.x * inv_w, r.y * inv_h, (r.x + r.width) * inv_w, (r.y + r.height) * inv_h };
+		out.width = r.width;
+		out.height = r.height;
+		return out;
+	}
+
+	void release_atlas(AtlasId atlas) {
+		auto it = s_atlases.find(atlas.handle);
+		if (it == s_atlases.end()) return;
+
+		release(it->second.texture);
+		s_atlases.erase(it);
+	}
+
+	void internal_clear_atlases() {
+		s_atlases.clear();
+		s_next_atlas = 1;
+	}
+
+} // namespace me::assets
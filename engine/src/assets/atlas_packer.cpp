@@ -0,0 +1,177 @@
+#include "atlas_packer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+namespace me::assets {
+
+	namespace {
+		// One horizontal segment of the skyline: [x, x + width) is filled up to y
+		struct SkylineNode {
+			int x, y, width;
+		};
+
+		class Skyline {
+		public:
+			Skyline(int width, int height) : m_width(width), m_height(height) {
+				m_nodes.push_back({ 0, 0, width });
+			}
+
+			// Bottom-left rule: lowest resulting top edge, then leftmost
+			bool insert(int w, int h, int& out_x, int& out_y) {
+				int best_index = -1;
+				int best_top = std::numeric_limits<int>::max();
+				int best_y = 0;
+
+				for (int i = 0; i < static_cast<int>(m_nodes.size()); ++i) {
+					int y = 0;
+					if (!fits(i, w, h, y)) continue;
+					if (y + h < best_top) {
+						best_top = y + h;
+						best_index = i;
+						best_y = y;
+					}
+				}
+				if (best_index < 0) return false;
+
+				out_x = m_nodes[best_index].x;
+				out_y = best_y;
+				add(best_index, out_x, out_y + h, w);
+				return true;
+			}
+
+		private:
+			// Rect starting at node i rests on the highest node it spans
+			bool fits(int i, int w, int h, int& out_y) const {
+				const int x = m_nodes[i].x;
+				if (x + w > m_width) return false;
+
+				int y = 0;
+				int remaining = w;
+				for (int j = i; remaining > 0; ++j) {
+					if (j >= static_cast<int>(m_nodes.size())) return false;
+					y = std::max(y, m_nodes[j].y);
+					if (y + h > m_height) return false;
+					remaining -= m_nodes[j].width;
+				}
+				out_y = y;
+				return true;
+			}
+
+			void add(int i, int x, int y, int w) {
+				m_nodes.insert(m_nodes.begin() + i, { x, y, w });
+
+				// Trim or drop the nodes now covered by the new one
+				for (std::size_t j = i + 1; j < m_nodes.size();) {
+					SkylineNode& node = m_nodes[j];
+					const int covered = x + w - node.x;
+					if (covered <= 0) break;
+					if (covered < node.width) {
+						node.x += covered;
+						node.width -= covered;
+						break;
+					}
+					m_nodes.erase(m_nodes.begin() + j);
+				}
+
+				// Merge neighbours at the same height
+				for (std::size_t j = 0; j + 1 < m_nodes.size();) {
+					if (m_nodes[j].y == m_nodes[j + 1].y) {
+						m_nodes[j].width += m_nodes[j + 1].width;
+						m_nodes.erase(m_nodes.begin() + j + 1);
+					} else {
+						++j;
+					}
+				}
+			}
+
+			int m_width, m_height;
+			std::vector<SkylineNode> m_nodes;
+		};
+
+		int next_pow2(int v) {
+			int p = 1;
+			while (p < v) p <<= 1;
+			return p;
+		}
+	} // namespace
+
+	bool internal_pack_skyline(std::vector<PackRect>& rects, int padding, int max_size, int& out_width, int& out_height) {
+		out_width = out_height = 0;
+		if (rects.empty()) return true;
+
+		padding = std::max(padding, 0);
+		const int pad2 = padding * 2;
+
+		// Tallest first keeps the skyline flat
+		std::vector<std::size_t> order(rects.size());
+		std::iota(order.begin(), order.end(), std::size_t{ 0 });
+		std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+			if (rects[a].height != rects[b].height) return rects[a].height > rects[b].height;
+			return rects[a].width > rects[b].width;
+		});
+
+		// Start from the total area, grow the shorter side until everything fits
+		std::int64_t area = 0;
+		int widest = 0, tallest = 0;
+		for (const PackRect& r : rects) {
+			if (r.width <= 0 || r.height <= 0) return false;
+			area += static_cast<std::int64_t>(r.width + pad2) * (r.height + pad2);
+			widest = std::max(widest, r.width + pad2);
+			tallest = std::max(tallest, r.height + pad2);
+		}
+
+		int w = next_pow2(std::max(widest, static_cast<int>(std::sqrt(static_cast<double>(area)))));
+		int h = next_pow2(tallest);
+		while (static_cast<std::int64_t>(w) * h < area) h *= 2;
+
+		while (w <= max_size && h <= max_size) {
+			Skyline skyline(w, h);
+			bool ok = true;
+			for (std::size_t i : order) {
+				int x = 0, y = 0;
+				if (!skyline.insert(rects[i].width + pad2, rects[i].height + pad2, x, y)) {
+					ok = false;
+					break;
+				}
+				rects[i].x = x + padding;
+				rects[i].y = y + padding;
+			}
+
+			if (ok) {
+				out_width = w;
+				out_height = h;
+				return true;
+			}
+
+			if (h <= w) h *= 2;
+			else w *= 2;
+		}
+		return false;
+	}
+
+	void internal_blit_rgba(std::uint8_t* atlas, int atlas_width, const std::uint8_t* src, int width, int height, int x, int y,
+		int padding, bool extrude) {
+		for (int row = 0; row < height; ++row)
+			std::memcpy(atlas + (static_cast<std::size_t>(y + row) * atlas_width + x) * 4, src + static_cast<std::size_t>(row) * width * 4, static_cast<std::size_t>(width) * 4);
+
+		if (!extrude || padding <= 0) return;
+
+		// Every padding pixel takes the nearest edge pixel (corners take the corner pixel)
+		for (int dy = -padding; dy < height + padding; ++dy) {
+			const int sy = std::clamp(dy, 0, height - 1);
+			for (int dx = -padding; dx < width + padding; ++dx) {
+				if (dx >= 0 && dx < width && dy >= 0 && dy < height) {
+					dx = width - 1; // Skip the interior
+					continue;
+				}
+				const int sx = std::clamp(dx, 0, width - 1);
+				std::memcpy(atlas + (static_cast<std::size_t>(y + dy) * atlas_width + x + dx) * 4, src + (static_cast<std::size_t>(sy) * width + sx) * 4, 4);
+			}
+		}
+	}
+
+} // namespace me::assets
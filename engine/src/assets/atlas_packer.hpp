@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace me::assets {
+
+	// Input: image size. Output: top-left of the image inside the atlas (padding excluded).
+	struct PackRect {
+		int width = 0, height = 0;
+		int x = 0, y = 0;
+	};
+
+	// Internal-only: skyline bottom-left packer. Places every rect with `padding` pixels on each side into the
+	// smallest power-of-two atlas (up to max_size per side). Returns false if they don't fit.
+	bool internal_pack_skyline(std::vector<PackRect>& rects, int padding, int max_size, int& out_width, int& out_height);
+
+	// Copies an RGBA8 image into the atlas at (x, y). With `extrude`, the `padding` ring around it repeats the
+	// image's edge pixels, so bilinear filtering and mip levels never sample a neighbour.
+	void internal_blit_rgba(std::uint8_t* atlas, int atlas_width, const std::uint8_t* src, int width, int height, int x, int y,
+		int padding, bool extrude);
+
+} // namespace me::assets
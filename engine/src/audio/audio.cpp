@@ -1,4 +1,6 @@
 #include "mini-engine-raylib/audio/audio.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+#include "../platform/platform.hpp"
 
 #include <raylib.h>
 
@@ -15,12 +17,15 @@ namespace me::audio {
 	namespace {
 		bool s_device_ready = false;
 
-		inline void ensure_audio_device() {
+		// Returns false when running headless (no audio device is ever opened)
+		inline bool ensure_audio_device() {
+			if (me::platform::is_headless()) return false;
 			if (!s_device_ready) {
 				InitAudioDevice();
 				::SetMasterVolume(1.0f);
 				s_device_ready = true;
 			}
+			return true;
 		}
 
 		// ---------- Sound cache ----------
@@ -96,7 +101,7 @@ namespace me::audio {
 	SoundId load(const char* uri) {
 		SoundId out{};
 		if (!uri || !*uri) return out;
-		ensure_audio_device();
+		if (!ensure_audio_device()) return out;
 
 		const std::string key = uri;
 		auto it = s_sound_by_path.find(key);
@@ -151,7 +156,7 @@ namespace me::audio {
 	}
 
 	void set_master_volume(float v) {
-		ensure_audio_device();
+		if (!ensure_audio_device()) return;
 		::SetMasterVolume(v < 0.f ? 0.f : (v > 1.f ? 1.f : v));
 	}
 
@@ -159,7 +164,7 @@ namespace me::audio {
 	MusicId load_music(const char* uri) {
 		MusicId out{};
 		if (!uri || !*uri) return out;
-		ensure_audio_device();
+		if (!ensure_audio_device()) return out;
 
 		const std::string key = uri;
 		auto it = s_music_by_path.find(key);
@@ -225,6 +230,7 @@ namespace me::audio {
 	void set_music_volume(MusicId id, float volume) { if (auto* m = get_native(id)) SetMusicVolume(*m, volume); }
 
 	void update() {
+		ME_PROFILE_SCOPE("audio::update");
 		for (auto& kv : s_music_by_path) {
 			if (kv.second.playing) UpdateMusicStream(kv.second.music);
 		}
@@ -0,0 +1,27 @@
+#include "mini-engine-raylib/audio/audio.hpp"
+
+// Audio backend for builds without raylib (ME_WITH_RAYLIB=OFF): every call is a no-op.
+namespace me::audio {
+
+	void init() {}
+	void shutdown() {}
+
+	SoundId load(const char*) { return {}; }
+	void release(SoundId) {}
+
+	void play(SoundId, float, float) {}
+	void stop(SoundId) {}
+	void set_master_volume(float) {}
+
+	MusicId load_music(const char*) { return {}; }
+	void release(MusicId) {}
+
+	void play_music(MusicId, bool, float) {}
+	void stop_music(MusicId) {}
+	void pause_music(MusicId) {}
+	void resume_music(MusicId) {}
+	void set_music_volume(MusicId, float) {}
+
+	void update() {}
+
+} // namespace me::audio
@@ -1,12 +1,24 @@
 #include "core/engine.hpp"
 #include "input/input.hpp" 
 #include "mini-engine-raylib/input/input_defaults.hpp"
-#include "audio/Audio.hpp"
-#include "assets/Assets.hpp"
+#include "audio/audio.hpp"
+#include "assets/assets.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+#include "mini-engine-raylib/core/frame_arena.hpp"
+#include "mini-engine-raylib/core/jobs.hpp"
+#include "mini-engine-raylib/ecs/commands.hpp"
+#include "time_internal.hpp"
+#include "replay_internal.hpp"
+#include "../ecs/changes_internal.hpp"
+#include "../ecs/transform_internal.hpp"
+#include "../platform/platform.hpp"
+#include "../render/render_internal.hpp"
+#include "../spatial/spatial_internal.hpp"
 
 #include <mini-ecs/registry.hpp>
 
-#include <raylib.h>
+#include <algorithm>
+#include <cmath>
 #include <memory>
 
 namespace me {
@@ -22,23 +34,20 @@ namespace me {
 	bool init(const AppConfig& config) {
 		s_State.config = config;
 
-		// 1. Raylib Window Initialization
-		if (config.vsync) {
-			SetConfigFlags(FLAG_VSYNC_HINT);
-		}
-
-		InitWindow(config.width, config.height, config.title.c_str());
-		SetExitKey(0); // Disable default ESC to close
-
-		if (!config.vsync) {
-			if (config.target_fps > 0) SetTargetFPS(config.target_fps);
-			else SetTargetFPS(0);
-		}
+		// 1. Platform Initialization (raylib window, or the null backend when headless)
+		if (!me::platform::init(config)) return false;
 
 		// 2. Engine Subsystem Initialization (UPDATED TO SNAKE_CASE)
 		me::input::setup_default_bindings();
-		me::audio::init();
-		me::audio::set_master_volume(0.9f);
+		if (!me::platform::is_headless()) {
+			me::audio::init();
+			me::audio::set_master_volume(0.9f);
+		}
+
+		me::frame_arena().reserve(config.frame_arena_size);
+
+		if (config.worker_threads >= 0)
+			me::jobs::init(static_cast<unsigned>(config.worker_threads));
 
 		// 3. ECS Init
 		s_State.registry = std::make_unique<Registry>();
@@ -50,47 +59,129 @@ namespace me {
 	void run(Application& app, const AppConfig& config) {
 		if (!init(config)) return;
 
+		// Playback wins if both are set
+		const bool replaying = !s_State.config.replay_file.empty() && me::replay::start_playback(s_State.config.replay_file.c_str());
+		if (!replaying && !s_State.config.record_file.empty())
+			me::replay::start_recording(s_State.config.record_file.c_str());
+
 		app.on_start();
 
 		int last_width = s_State.config.width;
 		int last_height = s_State.config.height;
 
+		// Fixed-step state (only used when fixed_tick_rate > 0)
+		const bool fixed_step = s_State.config.fixed_tick_rate > 0;
+		// Kept float-representable so it matches the float dt handed out each frame exactly
+		const double fixed_dt = fixed_step ? static_cast<float>(1.0 / s_State.config.fixed_tick_rate) : 0.0;
+		const int max_fixed_steps = std::max(1, s_State.config.max_fixed_steps);
 		double accumulator = 0.0;
-		int frames = 0;
 
-		while (s_State.running && !WindowShouldClose()) {
-			std::string title = s_State.config.title + " | FPS: " + std::to_string(GetFPS());
-			SetWindowTitle(title.c_str());
+		me::time::internal_set_fixed_delta(static_cast<float>(fixed_dt));
 
-			if (IsWindowResized()) {
-				int current_width = GetScreenWidth();
-				int current_height = GetScreenHeight();
+		auto& backend = me::platform::get();
+
+		// Title is only rebuilt when the FPS readout changes
+		std::string title = s_State.config.title;
+		const std::size_t title_base = title.size();
+		int shown_fps = -1;
+
+		while (s_State.running && !backend.should_close()) {
+			ME_PROFILE_SCOPE("Frame");
+
+			// Frees what was allocated two frames ago
+			me::frame_arena().begin_frame();
+			me::changes::internal_advance_tick();
+
+			if (const int fps = backend.fps(); fps != shown_fps) {
+				shown_fps = fps;
+				title.resize(title_base);
+				title += " | FPS: ";
+				title += std::to_string(fps);
+				backend.set_title(title.c_str());
+			}
+
+			if (backend.is_resized()) {
+				int current_width = backend.width();
+				int current_height = backend.height();
 				app.on_resize(current_width, current_height);
 				last_width = current_width;
 				last_height = current_height;
 			}
 
 			// -- Update Subsystems & Game --
-			float dt = GetFrameTime();
+			float dt = backend.frame_time();
 
 			me::input::poll();
-			app.on_update(dt);
 
-			BeginDrawing();
-			//ClearBackground({ 25, 25, 30, 255 });
-			ClearBackground({ 0, 0, 0, 0});
-			app.on_render();
-			EndDrawing();
+			// Record this frame, or swap in the recorded dt and input
+			if (!me::replay::internal_process_frame(dt) && replaying) {
+				close_application();
+				break;
+			}
+			me::time::internal_begin_frame(dt);
+
+			if (fixed_step) {
+				ME_PROFILE_SCOPE("FixedUpdate");
+				accumulator += dt;
+
+				int steps = 0;
+				while (accumulator >= fixed_dt && steps < max_fixed_steps) {
+					ME_PROFILE_SCOPE("Tick");
+					app.on_fixed_update(static_cast<float>(fixed_dt));
+					me::commands::flush(*s_State.registry);
+					accumulator -= fixed_dt;
+					++steps;
+				}
+
+				// Too far behind: drop the backlog instead of trying to catch up next frame
+				if (accumulator >= fixed_dt)
+					accumulator = std::fmod(accumulator, fixed_dt);
+
+				me::time::internal_set_alpha(static_cast<float>(accumulator / fixed_dt));
+			}
+
+			{
+				ME_PROFILE_SCOPE("Update");
+				app.on_update(dt);
+				me::commands::flush(*s_State.registry);
+
+				// The frame's one transform scan: rendering, spatial and change ticks read the cache it leaves.
+				// Queries during on_render and next frame's update see this frame's moves.
+				me::transform::internal_frame_update(*s_State.registry);
+				me::spatial::internal_frame_update();
+			}
+
+			{
+				ME_PROFILE_SCOPE("Render");
+				backend.begin_frame();
+				app.on_render();
+			}
+
+			{
+				ME_PROFILE_SCOPE("Present");
+				backend.end_frame();
+			}
 		}
 
 		app.on_shutdown();
 
+		shutdown();
+	}
+
+	void shutdown() {
+		if (!s_State.registry) return;
+
 		// 5. Engine Cleanup
+		me::replay::stop_recording();
+		me::replay::stop_playback();
+		me::jobs::shutdown();
 		s_State.registry.reset();
 		me::assets::release_all();
+		me::render::internal_shutdown();
 		me::audio::shutdown();
 
-		CloseWindow();
+		me::platform::shutdown();
+		s_State.running = false;
 	}
 
 	Registry& get_registry() {
@@ -102,11 +193,15 @@ namespace me {
 	}
 
 	int get_window_width() {
-		return GetScreenWidth();
+		return me::platform::get().width();
 	}
 
 	int get_window_height() {
-		return GetScreenHeight();
+		return me::platform::get().height();
+	}
+
+	bool is_headless() {
+		return me::platform::is_headless();
 	}
 
 } // namespace me
\ No newline at end of file
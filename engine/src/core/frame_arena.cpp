@@ -0,0 +1,123 @@
+#include "mini-engine-raylib/core/frame_arena.hpp"
+
+#include <algorithm>
+
+namespace me {
+
+	namespace {
+		inline std::size_t align_up(std::size_t v, std::size_t align) {
+			return (v + align - 1) & ~(align - 1);
+		}
+
+		inline std::byte* alloc_block(std::size_t size) {
+			return static_cast<std::byte*>(::operator new(size, std::align_val_t{ alignof(std::max_align_t) }));
+		}
+
+		inline void free_block(std::byte* p) {
+			::operator delete(p, std::align_val_t{ alignof(std::max_align_t) });
+		}
+	}
+
+	// ---------------- LinearArena ----------------
+	LinearArena::LinearArena(std::size_t capacity) {
+		reserve(capacity);
+	}
+
+	LinearArena::~LinearArena() {
+		for (std::byte* block : m_overflow) free_block(block);
+		if (m_block) free_block(m_block);
+	}
+
+	void* LinearArena::allocate(std::size_t size, std::size_t align) {
+		if (size == 0) size = 1;
+
+		// Fast path: bump inside the main block
+		const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(m_block);
+		const std::size_t offset = align_up(base + m_used, align) - base;
+		if (m_block && offset + size <= m_capacity) {
+			m_used = offset + size;
+			return m_block + offset;
+		}
+
+		// Slow path: chain an overflow block from the heap
+		std::uintptr_t cur = reinterpret_cast<std::uintptr_t>(m_overflow_cursor);
+		std::size_t pad = m_overflow_cursor ? align_up(cur, align) - cur : 0;
+		if (!m_overflow_cursor || pad + size > m_overflow_left) {
+			const std::size_t block_size = std::max(size + align, std::max<std::size_t>(m_capacity, 64 * 1024));
+			std::byte* block = alloc_block(block_size);
+			m_overflow.push_back(block);
+			m_overflow_cursor = block;
+			m_overflow_left = block_size;
+			cur = reinterpret_cast<std::uintptr_t>(block);
+			pad = align_up(cur, align) - cur;
+		}
+
+		std::byte* out = m_overflow_cursor + pad;
+		m_overflow_cursor = out + size;
+		m_overflow_left -= pad + size;
+		m_overflow_used += pad + size;
+		return out;
+	}
+
+	void LinearArena::reset() {
+		m_high_water = std::max(m_high_water, used());
+
+		m_used = 0;
+		m_overflow_used = 0;
+		m_overflow_left = 0;
+		m_overflow_cursor = nullptr;
+
+		if (!m_overflow.empty()) {
+			for (std::byte* block : m_overflow) free_block(block);
+			m_overflow.clear();
+			++m_overflow_count;
+
+			// Grow so the same load fits in one block next time
+			reserve(m_high_water + m_high_water / 4);
+		}
+	}
+
+	void LinearArena::reserve(std::size_t capacity) {
+		if (capacity <= m_capacity) return;
+
+		// Only valid while nothing lives in the main block
+		if (m_used != 0) return;
+
+		if (m_block) free_block(m_block);
+		m_block = alloc_block(capacity);
+		m_capacity = capacity;
+	}
+
+	// ---------------- FrameArena ----------------
+	FrameArena::FrameArena(std::size_t capacity_per_frame) {
+		reserve(capacity_per_frame);
+	}
+
+	void FrameArena::begin_frame() {
+		m_current ^= 1;
+
+		const std::size_t before = m_arenas[m_current].overflow_count();
+		m_arenas[m_current].reset();
+		if (m_arenas[m_current].overflow_count() != before) ++m_overflow_frames;
+	}
+
+	void FrameArena::reserve(std::size_t capacity_per_frame) {
+		m_arenas[0].reserve(capacity_per_frame);
+		m_arenas[1].reserve(capacity_per_frame);
+	}
+
+	FrameArenaStats FrameArena::stats() const {
+		FrameArenaStats s;
+		s.used = m_arenas[m_current].used();
+		s.capacity = m_arenas[m_current].capacity();
+		s.high_water = std::max({ m_arenas[0].high_water(), m_arenas[1].high_water(), s.used });
+		s.overflows = m_overflow_frames;
+		return s;
+	}
+
+	FrameArena& frame_arena() {
+		static FrameArena s_arena;
+		return s_arena;
+	}
+
+} // namespace me
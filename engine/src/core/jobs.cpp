@@ -0,0 +1,270 @@
+#include "mini-engine-raylib/core/jobs.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace me::jobs {
+
+	namespace detail {
+		// Outstanding work behind a Handle, plus jobs waiting for it to reach zero
+		struct Counter {
+			std::atomic<int> pending{ 1 };
+			std::mutex mutex;
+			std::vector<Job> continuations;
+		};
+	}
+
+	struct Access {
+		static Handle make(std::shared_ptr<detail::Counter> c) {
+			Handle h;
+			h.m_counter = std::move(c);
+			return h;
+		}
+
+		static const std::shared_ptr<detail::Counter>& counter(const Handle& h) {
+			return h.m_counter;
+		}
+	};
+
+	namespace {
+
+		struct Task {
+			Job fn;
+			std::shared_ptr<detail::Counter> counter;
+		};
+
+		// Owner pushes/pops at the back (LIFO, cache-warm), thieves take from the front
+		struct WorkQueue {
+			std::mutex mutex;
+			std::deque<Task> tasks;
+		};
+
+		std::vector<std::unique_ptr<WorkQueue>> s_queues; // [0] = main thread
+		std::vector<std::thread> s_workers;
+
+		std::atomic<bool> s_stop{ false };
+		std::atomic<int> s_queued{ 0 };
+		std::mutex s_sleep_mutex;
+		std::condition_variable s_sleep_cv;
+
+		thread_local unsigned t_index = 0;
+
+		void push(Task task);
+
+		void complete(detail::Counter& counter) {
+			if (counter.pending.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+			std::vector<Job> ready;
+			{
+				std::lock_guard lock(counter.mutex);
+				ready.swap(counter.continuations);
+			}
+			for (auto& job : ready) job();
+		}
+
+		// Runs `job` once `counter` is done (immediately if it already is)
+		void on_complete(detail::Counter& counter, Job job) {
+			{
+				std::lock_guard lock(counter.mutex);
+				if (counter.pending.load(std::memory_order_acquire) != 0) {
+					counter.continuations.push_back(std::move(job));
+					return;
+				}
+			}
+			job();
+		}
+
+		void execute(Task& task) {
+			task.fn();
+			complete(*task.counter);
+		}
+
+		bool pop_local(unsigned index, Task& out) {
+			auto& q = *s_queues[index];
+			std::lock_guard lock(q.mutex);
+			if (q.tasks.empty()) return false;
+			out = std::move(q.tasks.back());
+			q.tasks.pop_back();
+			s_queued.fetch_sub(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		bool steal(unsigned thief, Task& out) {
+			const unsigned n = static_cast<unsigned>(s_queues.size());
+			for (unsigned k = 1; k < n; ++k) {
+				auto& q = *s_queues[(thief + k) % n];
+				std::lock_guard lock(q.mutex);
+				if (q.tasks.empty()) continue;
+				out = std::move(q.tasks.front());
+				q.tasks.pop_front();
+				s_queued.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+			return false;
+		}
+
+		bool try_run_one() {
+			if (s_queues.empty()) return false;
+			Task task;
+			if (pop_local(t_index, task) || steal(t_index, task)) {
+				execute(task);
+				return true;
+			}
+			return false;
+		}
+
+		void push(Task task) {
+			if (s_workers.empty()) {
+				execute(task);
+				return;
+			}
+
+			{
+				auto& q = *s_queues[t_index];
+				std::lock_guard lock(q.mutex);
+				q.tasks.push_back(std::move(task));
+			}
+			s_queued.fetch_add(1, std::memory_order_release);
+
+			// Lock pairs with the sleeper's predicate check so the wake-up can't be missed
+			{ std::lock_guard lock(s_sleep_mutex); }
+			s_sleep_cv.notify_one();
+		}
+
+		void worker_main(unsigned index) {
+			t_index = index;
+
+			while (!s_stop.load(std::memory_order_acquire)) {
+				if (try_run_one()) continue;
+
+				std::unique_lock lock(s_sleep_mutex);
+				s_sleep_cv.wait(lock, [] {
+					return s_stop.load(std::memory_order_acquire) || s_queued.load(std::memory_order_acquire) > 0;
+				});
+			}
+		}
+
+	} // namespace
+
+	bool Handle::is_done() const {
+		return !m_counter || m_counter->pending.load(std::memory_order_acquire) == 0;
+	}
+
+	void init(unsigned worker_count) {
+		if (!s_workers.empty()) return;
+
+		if (worker_count == 0) {
+			const unsigned hw = std::thread::hardware_concurrency();
+			worker_count = hw > 1 ? hw - 1 : 0;
+		}
+
+		s_stop.store(false);
+		s_queues.clear();
+		for (unsigned i = 0; i <= worker_count; ++i)
+			s_queues.push_back(std::make_unique<WorkQueue>());
+
+		for (unsigned i = 1; i <= worker_count; ++i)
+			s_workers.emplace_back(worker_main, i);
+	}
+
+	void shutdown() {
+		// Drain whatever is left so no handle stays pending forever
+		while (try_run_one()) {}
+
+		{
+			std::lock_guard lock(s_sleep_mutex);
+			s_stop.store(true, std::memory_order_release);
+		}
+		s_sleep_cv.notify_all();
+
+		for (auto& t : s_workers) t.join();
+		s_workers.clear();
+		s_queues.clear();
+		s_queued.store(0);
+	}
+
+	unsigned worker_count() {
+		return static_cast<unsigned>(s_workers.size());
+	}
+
+	unsigned thread_index() {
+		return t_index;
+	}
+
+	Handle submit(Job job) {
+		auto counter = std::make_shared<detail::Counter>();
+		Handle handle = Access::make(counter);
+		push(Task{ std::move(job), std::move(counter) });
+		return handle;
+	}
+
+	Handle submit(Job job, std::initializer_list<Handle> dependencies) {
+		return submit(std::move(job), std::span<const Handle>(dependencies.begin(), dependencies.size()));
+	}
+
+	Handle submit(Job job, std::span<const Handle> dependencies) {
+		auto counter = std::make_shared<detail::Counter>();
+		Handle handle = Access::make(counter);
+
+		// Gate opens when the last dependency completes (+1 held while registering)
+		auto gate = std::make_shared<std::atomic<int>>(static_cast<int>(dependencies.size()) + 1);
+		auto task = std::make_shared<Task>(Task{ std::move(job), counter });
+
+		auto release = [gate, task]() {
+			if (gate->fetch_sub(1, std::memory_order_acq_rel) == 1)
+				push(std::move(*task));
+		};
+
+		for (const Handle& dep : dependencies) {
+			const auto& dep_counter = Access::counter(dep);
+			if (dep_counter) on_complete(*dep_counter, release);
+			else release();
+		}
+		release();
+
+		return handle;
+	}
+
+	void wait(const Handle& handle) {
+		ME_PROFILE_SCOPE("jobs::wait");
+		while (!handle.is_done()) {
+			if (!try_run_one()) std::this_thread::yield();
+		}
+	}
+
+	void parallel_for_chunks(std::size_t begin, std::size_t end, std::size_t grain,
+		const std::function<void(std::size_t, std::size_t)>& fn) {
+		if (begin >= end) return;
+		grain = std::max<std::size_t>(grain, 1);
+
+		const std::size_t count = end - begin;
+		if (s_workers.empty() || count <= grain) {
+			fn(begin, end);
+			return;
+		}
+
+		// One counter for the whole range: the caller waits on a single handle
+		const std::size_t chunks = (count + grain - 1) / grain;
+		auto counter = std::make_shared<detail::Counter>();
+		counter->pending.store(static_cast<int>(chunks), std::memory_order_relaxed);
+
+		// Keep the first chunk for this thread, queue the rest
+		for (std::size_t c = 1; c < chunks; ++c) {
+			const std::size_t b = begin + c * grain;
+			const std::size_t e = std::min(end, b + grain);
+			push(Task{ [&fn, b, e]() { fn(b, e); }, counter });
+		}
+
+		fn(begin, std::min(end, begin + grain));
+		complete(*counter);
+
+		wait(Access::make(counter));
+	}
+
+} // namespace me::jobs
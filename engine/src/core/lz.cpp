@@ -0,0 +1,123 @@
+#include "lz.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace me::lz {
+
+	// Sequence layout:
+	//   token: u8, high nibble = literal count, low nibble = match length - 4 (15 = more bytes follow)
+	//   extra literal count: u8s of 255 until one below 255 (only when the nibble is 15)
+	//   literals
+	//   offset: u16 little-endian, back from the current output position
+	//   extra match length: like the literal count
+	// The last sequence has literals only (possibly none) and ends the block.
+
+	namespace {
+		constexpr int k_hash_bits = 14;
+		constexpr std::size_t k_min_match = 4;
+		constexpr std::size_t k_max_offset = 0xFFFF;
+
+		std::uint32_t load32(const std::byte* p) {
+			std::uint32_t v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		std::uint32_t hash(std::uint32_t v) {
+			return (v * 2654435761u) >> (32 - k_hash_bits);
+		}
+
+		void put_length(std::vector<std::byte>& out, std::size_t length) {
+			for (; length >= 255; length -= 255) out.push_back(std::byte{ 255 });
+			out.push_back(static_cast<std::byte>(length));
+		}
+
+		bool get_length(const std::byte* src, std::size_t size, std::size_t& pos, std::size_t& length) {
+			std::uint8_t b = 0;
+			do {
+				if (pos >= size) return false;
+				b = static_cast<std::uint8_t>(src[pos++]);
+				length += b;
+			} while (b == 255);
+			return true;
+		}
+
+		void put_sequence(std::vector<std::byte>& out, const std::byte* literals, std::size_t literal_count, std::size_t offset, std::size_t match) {
+			const std::size_t extra = match ? match - k_min_match : 0;
+			const std::uint8_t token = static_cast<std::uint8_t>((std::min<std::size_t>(literal_count, 15) << 4) | std::min<std::size_t>(extra, 15));
+			out.push_back(static_cast<std::byte>(token));
+			if (literal_count >= 15) put_length(out, literal_count - 15);
+			out.insert(out.end(), literals, literals + literal_count);
+			if (!match) return;
+
+			out.push_back(static_cast<std::byte>(offset & 0xFF));
+			out.push_back(static_cast<std::byte>(offset >> 8));
+			if (extra >= 15) put_length(out, extra - 15);
+		}
+	} // namespace
+
+	void internal_compress(const std::byte* src, std::size_t size, std::vector<std::byte>& out) {
+		// Last position each 4-byte sequence was seen at, + 1 (0 = never)
+		std::array<std::uint32_t, std::size_t{ 1 } << k_hash_bits> table{};
+
+		std::size_t anchor = 0;
+		std::size_t i = 0;
+		while (i + k_min_match <= size) {
+			const std::uint32_t seq = load32(src + i);
+			std::uint32_t& slot = table[hash(seq)];
+			const std::size_t candidate = slot;
+			slot = static_cast<std::uint32_t>(i + 1);
+
+			if (candidate == 0 || i - (candidate - 1) > k_max_offset || load32(src + candidate - 1) != seq) {
+				++i;
+				continue;
+			}
+
+			const std::size_t from = candidate - 1;
+			std::size_t match = k_min_match;
+			while (i + match < size && src[from + match] == src[i + match]) ++match;
+
+			put_sequence(out, src + anchor, i - anchor, i - from, match);
+			i += match;
+			anchor = i;
+		}
+
+		put_sequence(out, src + anchor, size - anchor, 0, 0);
+	}
+
+	bool internal_decompress(const std::byte* src, std::size_t size, std::byte* dst, std::size_t dst_size) {
+		std::size_t in = 0;
+		std::size_t out = 0;
+		while (in < size) {
+			const std::uint8_t token = static_cast<std::uint8_t>(src[in++]);
+
+			std::size_t literal_count = token >> 4;
+			if (literal_count == 15 && !get_length(src, size, in, literal_count)) return false;
+			if (literal_count > size - in || literal_count > dst_size - out) return false;
+			std::memcpy(dst + out, src + in, literal_count);
+			in += literal_count;
+			out += literal_count;
+			if (in == size) break;
+
+			if (size - in < 2) return false;
+			const std::size_t offset = static_cast<std::size_t>(src[in]) | (static_cast<std::size_t>(src[in + 1]) << 8);
+			in += 2;
+			if (offset == 0 || offset > out) return false;
+
+			std::size_t match = token & 15;
+			if (match == 15 && !get_length(src, size, in, match)) return false;
+			match += k_min_match;
+			if (match > dst_size - out) return false;
+
+			// Byte by byte: the source may overlap what this copy writes (runs)
+			const std::byte* from = dst + out - offset;
+			for (std::size_t k = 0; k < match; ++k) dst[out + k] = from[k];
+			out += match;
+		}
+		return out == dst_size;
+	}
+
+} // namespace me::lz
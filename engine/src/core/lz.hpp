@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace me::lz {
+
+	// Internal-only: byte-oriented LZ77 block codec (LZ4-style sequences: a literal run, then a back-reference of
+	// at least 4 bytes up to 64 KiB back). Fast to decode, no entropy stage. Appends the compressed block to `out`.
+	void internal_compress(const std::byte* src, std::size_t size, std::vector<std::byte>& out);
+
+	// Decodes exactly `dst_size` bytes. False on a malformed block instead of reading or writing out of bounds.
+	bool internal_decompress(const std::byte* src, std::size_t size, std::byte* dst, std::size_t dst_size);
+
+} // namespace me::lz
@@ -0,0 +1,186 @@
+#include "mini-engine-raylib/core/profiler.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace me::profiler {
+
+	namespace {
+
+		enum class EventKind : std::uint8_t { Zone, Counter };
+
+		struct Event {
+			const char* name = nullptr;
+			std::int64_t start = 0;    // ns since process start
+			std::int64_t end = 0;      // Zone: end ns. Counter: unused
+			double value = 0.0;        // Counter value
+			std::uint16_t depth = 0;
+			EventKind kind = EventKind::Zone;
+		};
+
+		// Single-producer ring: only the owning thread writes, the dumper reads up to `head`. `writing` is set
+		// around each push so a dump can wait out a push that saw the capture still running.
+		struct ThreadBuffer {
+			std::vector<Event> events = std::vector<Event>(k_events_per_thread);
+			std::atomic<std::uint64_t> head{ 0 };
+			std::atomic<bool> writing{ false };
+			std::uint32_t thread_index = 0;
+			std::uint16_t depth = 0;
+		};
+
+		std::atomic<bool> s_capturing{ false };
+		std::atomic<std::int64_t> s_capture_start{ 0 };
+		std::atomic<std::int64_t> s_capture_end{ 0 };
+
+		// Only touched when a thread records its first event, when dumping, or when a capture begins (so one
+		// can't start while a dump reads the rings)
+		std::mutex s_threads_mutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> s_threads;
+
+		inline std::int64_t now_ns() {
+			using namespace std::chrono;
+			static const steady_clock::time_point s_origin = steady_clock::now();
+			return duration_cast<nanoseconds>(steady_clock::now() - s_origin).count();
+		}
+
+		[[maybe_unused]] ThreadBuffer& local_buffer() {
+			thread_local ThreadBuffer* t_buffer = nullptr;
+			if (!t_buffer) {
+				auto buffer = std::make_unique<ThreadBuffer>();
+				std::lock_guard lock(s_threads_mutex);
+				buffer->thread_index = static_cast<std::uint32_t>(s_threads.size());
+				t_buffer = buffer.get();
+				s_threads.push_back(std::move(buffer));
+			}
+			return *t_buffer;
+		}
+
+		// Dropped once the capture has ended. Both sides are seq_cst: either this sees s_capturing cleared or
+		// the dump sees `writing` set and waits.
+		[[maybe_unused]] inline void push(ThreadBuffer& buf, const Event& ev) {
+			buf.writing.store(true, std::memory_order_seq_cst);
+			if (s_capturing.load(std::memory_order_seq_cst)) {
+				const std::uint64_t h = buf.head.load(std::memory_order_relaxed);
+				buf.events[h & (k_events_per_thread - 1)] = ev;
+				buf.head.store(h + 1, std::memory_order_release);
+			}
+			buf.writing.store(false, std::memory_order_release);
+		}
+
+		void write_escaped(std::ostream& out, const char* s) {
+			for (; s && *s; ++s) {
+				const char c = *s;
+				if (c == '"' || c == '\\') out << '\\' << c;
+				else if (static_cast<unsigned char>(c) < 0x20) out << ' ';
+				else out << c;
+			}
+		}
+	} // namespace
+
+	void begin_capture() {
+		std::lock_guard lock(s_threads_mutex);
+		s_capture_start.store(now_ns(), std::memory_order_relaxed);
+		s_capture_end.store(0, std::memory_order_relaxed);
+		s_capturing.store(true, std::memory_order_release);
+	}
+
+	void end_capture() {
+		s_capture_end.store(now_ns(), std::memory_order_relaxed);
+		s_capturing.store(false, std::memory_order_seq_cst);
+	}
+
+	bool is_capturing() {
+		return s_capturing.load(std::memory_order_relaxed);
+	}
+
+	bool dump_chrome_trace(const char* path) {
+		// Recording threads write the rings while capturing, so those can't be read then
+		if (s_capturing.load(std::memory_order_seq_cst)) return false;
+
+		std::ofstream out(path, std::ios::binary);
+		if (!out) return false;
+
+		const std::int64_t from = s_capture_start.load(std::memory_order_relaxed);
+		const std::int64_t to = s_capture_end.load(std::memory_order_relaxed);
+
+		out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		bool first = true;
+		char num[64];
+
+		std::lock_guard lock(s_threads_mutex);
+		for (const auto& buf : s_threads) {
+			while (buf->writing.load(std::memory_order_acquire)) std::this_thread::yield();
+			const std::uint64_t head = buf->head.load(std::memory_order_acquire);
+			const std::uint64_t count = head < k_events_per_thread ? head : k_events_per_thread;
+
+			for (std::uint64_t i = head - count; i < head; ++i) {
+				const Event& ev = buf->events[i & (k_events_per_thread - 1)];
+				if (ev.start < from || ev.start > to) continue;
+
+				out << (first ? "\n" : ",\n");
+				first = false;
+
+				out << "{\"name\":\"";
+				write_escaped(out, ev.name);
+				out << "\",\"pid\":1,\"tid\":" << buf->thread_index;
+
+				// Chrome expects microseconds
+				std::snprintf(num, sizeof(num), "%.3f", (ev.start - from) / 1000.0);
+				out << ",\"ts\":" << num;
+
+				if (ev.kind == EventKind::Zone) {
+					std::snprintf(num, sizeof(num), "%.3f", (ev.end - ev.start) / 1000.0);
+					out << ",\"ph\":\"X\",\"dur\":" << num << ",\"args\":{\"depth\":" << ev.depth << "}}";
+				} else {
+					std::snprintf(num, sizeof(num), "%.17g", ev.value);
+					out << ",\"ph\":\"C\",\"args\":{\"value\":" << num << "}}";
+				}
+			}
+		}
+
+		out << "\n]}\n";
+		return static_cast<bool>(out);
+	}
+
+#if ME_ENABLE_PROFILER
+	ScopedZone::ScopedZone(const char* name) noexcept : m_name(name), m_start(-1) {
+		if (!s_capturing.load(std::memory_order_relaxed)) return;
+		++local_buffer().depth;
+		m_start = now_ns();
+	}
+
+	ScopedZone::~ScopedZone() noexcept {
+		if (m_start < 0) return;
+
+		const std::int64_t end = now_ns();
+		ThreadBuffer& buf = local_buffer();
+		--buf.depth;
+
+		Event ev;
+		ev.name = m_name;
+		ev.start = m_start;
+		ev.end = end;
+		ev.depth = buf.depth;
+		ev.kind = EventKind::Zone;
+		push(buf, ev);
+	}
+
+	void counter(const char* name, double value) noexcept {
+		if (!s_capturing.load(std::memory_order_relaxed)) return;
+
+		Event ev;
+		ev.name = name;
+		ev.start = now_ns();
+		ev.value = value;
+		ev.kind = EventKind::Counter;
+		push(local_buffer(), ev);
+	}
+#endif
+
+} // namespace me::profiler
@@ -0,0 +1,225 @@
+#include "replay_internal.hpp"
+#include "../input/input_internal.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace me::replay {
+
+	// Log layout (little-endian):
+	//   header: "MERP" u16 version, u8 key count, u8 mouse button count
+	//   frames: u8 flags, followed only by the fields whose flag is set.
+	//           Fields that didn't change (or are zero this frame) are skipped.
+
+	namespace {
+		constexpr std::uint32_t k_magic = 'M' | 'E' << 8 | 'R' << 16 | 'P' << 24;    // "MERP"
+		constexpr std::uint16_t k_version = 1;
+
+		enum FrameFlags : std::uint8_t {
+			Dt             = 1 << 0, // f32, when different from last frame
+			KeysDown       = 1 << 1, // u64, when changed
+			KeyEdges       = 1 << 2, // u64 pressed, u64 released, when any is set
+			MouseButtons   = 1 << 3, // u8 down, u8 pressed, u8 released
+			MousePosition  = 1 << 4, // f32 x, f32 y, when changed
+			MouseDelta     = 1 << 5, // f32 x, f32 y, when non-zero
+			MouseWheel     = 1 << 6, // f32, when non-zero
+		};
+
+		enum class Mode { Off, Recording, Playing };
+
+		Mode s_mode = Mode::Off;
+		std::uint64_t s_frame = 0;
+
+		// Last frame written/read: unchanged fields are delta-encoded against it
+		float s_prev_dt = 0.0f;
+		me::input::FrameInput s_prev{};
+
+		std::ofstream s_out;
+		std::vector<std::uint8_t> s_buffer;    // Recording: pending bytes. Playback: whole file
+		std::size_t s_read_pos = 0;
+
+		template <typename T>
+		void put(const T& v) {
+			static_assert(std::is_scalar_v<T>, "put() writes scalars");
+			const std::size_t at = s_buffer.size();
+			s_buffer.resize(at + sizeof(T));
+			std::memcpy(s_buffer.data() + at, &v, sizeof(T));
+		}
+
+		template <typename T>
+		bool get(T& v) {
+			if (s_read_pos + sizeof(T) > s_buffer.size()) return false;
+			std::memcpy(&v, s_buffer.data() + s_read_pos, sizeof(T));
+			s_read_pos += sizeof(T);
+			return true;
+		}
+
+		template <typename T>
+		bool same_bits(const T& a, const T& b) {
+			return std::memcmp(&a, &b, sizeof(T)) == 0;
+		}
+
+		void flush() {
+			if (s_buffer.empty()) return;
+			s_out.write(reinterpret_cast<const char*>(s_buffer.data()), static_cast<std::streamsize>(s_buffer.size()));
+			s_buffer.clear();
+		}
+
+		void record(float dt, const me::input::FrameInput& in) {
+			std::uint8_t flags = 0;
+			const me::math::Vec2 zero{};
+
+			if (!same_bits(dt, s_prev_dt)) flags |= Dt;
+			if (in.keys_down != s_prev.keys_down) flags |= KeysDown;
+			if (in.keys_pressed || in.keys_released) flags |= KeyEdges;
+			if (in.mouse_down != s_prev.mouse_down || in.mouse_pressed || in.mouse_released) flags |= MouseButtons;
+			if (!same_bits(in.mouse_position, s_prev.mouse_position)) flags |= MousePosition;
+			if (!same_bits(in.mouse_delta, zero)) flags |= MouseDelta;
+			if (!same_bits(in.mouse_wheel, 0.0f)) flags |= MouseWheel;
+
+			put(flags);
+			if (flags & Dt) put(dt);
+			if (flags & KeysDown) put(in.keys_down);
+			if (flags & KeyEdges) { put(in.keys_pressed); put(in.keys_released); }
+			if (flags & MouseButtons) { put(in.mouse_down); put(in.mouse_pressed); put(in.mouse_released); }
+			if (flags & MousePosition) { put(in.mouse_position.x); put(in.mouse_position.y); }
+			if (flags & MouseDelta) { put(in.mouse_delta.x); put(in.mouse_delta.y); }
+			if (flags & MouseWheel) put(in.mouse_wheel);
+
+			if (s_buffer.size() >= 64 * 1024) flush();
+		}
+
+		bool play(float& dt, me::input::FrameInput& in) {
+			std::uint8_t flags = 0;
+			if (!get(flags)) return false;
+
+			// Start from the previous frame; per-frame fields default to zero
+			me::input::FrameInput next{};
+			next.keys_down = s_prev.keys_down;
+			next.mouse_down = s_prev.mouse_down;
+			next.mouse_position = s_prev.mouse_position;
+			float next_dt = s_prev_dt;
+
+			bool ok = true;
+			if (flags & Dt) ok &= get(next_dt);
+			if (flags & KeysDown) ok &= get(next.keys_down);
+			if (flags & KeyEdges) { ok &= get(next.keys_pressed); ok &= get(next.keys_released); }
+			if (flags & MouseButtons) { ok &= get(next.mouse_down); ok &= get(next.mouse_pressed); ok &= get(next.mouse_released); }
+			if (flags & MousePosition) { ok &= get(next.mouse_position.x); ok &= get(next.mouse_position.y); }
+			if (flags & MouseDelta) { ok &= get(next.mouse_delta.x); ok &= get(next.mouse_delta.y); }
+			if (flags & MouseWheel) ok &= get(next.mouse_wheel);
+			if (!ok) return false;
+
+			dt = next_dt;
+			in = next;
+			return true;
+		}
+
+		void reset_state() {
+			s_frame = 0;
+			s_prev_dt = 0.0f;
+			s_prev = {};
+			s_buffer.clear();
+			s_read_pos = 0;
+		}
+	} // namespace
+
+	bool start_recording(const char* path) {
+		stop_recording();
+		stop_playback();
+
+		s_out.open(path, std::ios::binary | std::ios::trunc);
+		if (!s_out) {
+			std::cerr << "Replay: can't open " << path << " for recording\n";
+			return false;
+		}
+
+		reset_state();
+		put(k_magic);
+		put(k_version);
+		put(static_cast<std::uint8_t>(me::input::k_key_count));
+		put(static_cast<std::uint8_t>(me::input::k_mouse_button_count));
+
+		s_mode = Mode::Recording;
+		return true;
+	}
+
+	void stop_recording() {
+		if (s_mode != Mode::Recording) return;
+		flush();
+		s_out.close();
+		s_mode = Mode::Off;
+	}
+
+	bool is_recording() {
+		return s_mode == Mode::Recording;
+	}
+
+	bool start_playback(const char* path) {
+		stop_recording();
+		stop_playback();
+
+		std::ifstream in(path, std::ios::binary);
+		if (!in) {
+			std::cerr << "Replay: can't open " << path << "\n";
+			return false;
+		}
+
+		reset_state();
+		s_buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+		std::uint32_t magic = 0;
+		std::uint16_t version = 0;
+		std::uint8_t keys = 0, buttons = 0;
+		get(magic); get(version); get(keys); get(buttons);
+
+		if (magic != k_magic || version != k_version ||
+			keys != me::input::k_key_count || buttons != me::input::k_mouse_button_count) {
+			std::cerr << "Replay: " << path << " is not a compatible replay log\n";
+			reset_state();
+			return false;
+		}
+
+		s_mode = Mode::Playing;
+		return true;
+	}
+
+	void stop_playback() {
+		if (s_mode != Mode::Playing) return;
+		reset_state();
+		s_mode = Mode::Off;
+	}
+
+	bool is_playing() {
+		return s_mode == Mode::Playing;
+	}
+
+	std::uint64_t frame_index() {
+		return s_frame;
+	}
+
+	bool internal_process_frame(float& dt) {
+		auto& frame = me::input::internal_frame_input();
+
+		if (s_mode == Mode::Recording) {
+			record(dt, frame);
+		} else if (s_mode == Mode::Playing) {
+			if (!play(dt, frame)) {
+				stop_playback();
+				return false;
+			}
+		} else {
+			return true;
+		}
+
+		s_prev_dt = dt;
+		s_prev = frame;
+		++s_frame;
+		return true;
+	}
+
+} // namespace me::replay
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "mini-engine-raylib/core/replay.hpp"
+
+namespace me::replay {
+
+	// Internal-only: called by the engine right after input::poll().
+	// Records the live frame, or replaces dt and the input snapshot with the next recorded frame.
+	// Returns false when playback just ran out of frames.
+	bool internal_process_frame(float& dt);
+
+} // namespace me::replay
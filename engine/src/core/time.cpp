@@ -1,19 +1,47 @@
 #include "mini-engine-raylib/core/time.hpp"
-
-#include <raylib.h>
+#include "time_internal.hpp"
+#include "../platform/platform.hpp"
 
 namespace me::time {
 
+	namespace {
+		float s_delta = 0.0f;
+		double s_elapsed = 0.0;
+		float s_fixed_delta = 0.0f;
+		float s_alpha = 0.0f;
+	}
+
 	float delta() {
-		return GetFrameTime();
+		return s_delta;
 	}
 
 	double elapsed() {
-		return GetTime();
+		return s_elapsed;
 	}
 
 	int get_fps() {
-		return ::GetFPS();
+		return me::platform::get().fps();
+	}
+
+	float fixed_delta() {
+		return s_fixed_delta;
+	}
+
+	float alpha() {
+		return s_alpha;
+	}
+
+	void internal_begin_frame(float dt) {
+		s_delta = dt;
+		s_elapsed += dt;
+	}
+
+	void internal_set_fixed_delta(float fixed_dt) {
+		s_fixed_delta = fixed_dt;
+	}
+
+	void internal_set_alpha(float a) {
+		s_alpha = a;
 	}
 
-} // namespace me::time
\ No newline at end of file
+} // namespace me::time
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "mini-engine-raylib/core/time.hpp"
+
+namespace me::time {
+
+	// Internal-only: written by the engine loop
+	void internal_begin_frame(float dt);
+	void internal_set_fixed_delta(float fixed_dt);
+	void internal_set_alpha(float alpha);
+
+} // namespace me::time
@@ -0,0 +1,19 @@
+#include "changes_internal.hpp"
+
+#include <atomic>
+
+namespace me::changes {
+
+	namespace {
+		std::atomic<Tick> s_tick{ 1 };
+	} // namespace
+
+	Tick tick() {
+		return s_tick.load(std::memory_order_relaxed);
+	}
+
+	void internal_advance_tick() {
+		s_tick.fetch_add(1, std::memory_order_relaxed);
+	}
+
+} // namespace me::changes
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "mini-engine-raylib/ecs/changes.hpp"
+
+namespace me::changes {
+
+	// Internal-only: called by the engine loop at the top of every frame
+	void internal_advance_tick();
+
+} // namespace me::changes
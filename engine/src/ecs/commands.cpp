@@ -0,0 +1,123 @@
+#include "mini-engine-raylib/ecs/commands.hpp"
+
+#include "mini-engine-raylib/core/profiler.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace me {
+
+	namespace {
+		// One buffer per thread that ever recorded, owned here so they outlive their threads
+		std::mutex s_buffers_mutex;
+		std::vector<std::unique_ptr<CommandBuffer>> s_buffers;
+		std::vector<CommandBuffer*> s_flush_list;
+
+		commands::Stats s_stats;
+	} // namespace
+
+	void detail::playback(Registry& reg, std::span<CommandBuffer* const> buffers, commands::Stats& stats) {
+		ME_PROFILE_SCOPE("commands::playback");
+
+		stats = {};
+		std::size_t types = 0;
+		for (CommandBuffer* buf : buffers) {
+			stats.commands += buf->m_count;
+			types = std::max(types, buf->m_columns.size());
+		}
+		if (stats.commands == 0) return;
+
+		// 1. Creates, so pending targets resolve
+		for (CommandBuffer* buf : buffers) {
+			buf->m_created.resize(buf->m_creates.size());
+			for (std::size_t i = 0; i < buf->m_creates.size(); ++i)
+				buf->m_created[i] = reg.create_entity(buf->m_creates[i]);
+			stats.created += buf->m_creates.size();
+		}
+
+		// 2. Destroys, sorted and deduplicated
+		std::vector<me::entity::entity_id> destroys;
+		for (CommandBuffer* buf : buffers) destroys.insert(destroys.end(), buf->m_destroys.begin(), buf->m_destroys.end());
+		std::sort(destroys.begin(), destroys.end());
+		const auto unique_end = std::unique(destroys.begin(), destroys.end());
+		stats.coalesced += static_cast<std::size_t>(destroys.end() - unique_end);
+		destroys.erase(unique_end, destroys.end());
+
+		for (me::entity::entity_id e : destroys) {
+			if (!reg.is_alive(e)) {
+				++stats.coalesced;
+				continue;
+			}
+			reg.destroy_entity(e);
+			++stats.destroyed;
+		}
+
+		// 3. Component changes, one type at a time across every buffer
+		std::vector<detail::CommandSource> sources;
+		for (std::size_t id = 0; id < types; ++id) {
+			sources.clear();
+			for (std::size_t b = 0; b < buffers.size(); ++b) {
+				CommandBuffer* buf = buffers[b];
+				if (id >= buf->m_columns.size() || !buf->m_columns[id] || buf->m_columns[id]->commands.empty()) continue;
+				sources.push_back({ buf->m_columns[id].get(), buf->m_created.data(), static_cast<std::uint32_t>(b) });
+			}
+			if (!sources.empty()) sources.front().column->apply(reg, sources, stats);
+		}
+
+		for (CommandBuffer* buf : buffers) buf->clear();
+
+		ME_PROFILE_COUNTER("commands::applied", stats.commands - stats.coalesced);
+	}
+
+	commands::Stats CommandBuffer::playback(Registry& reg) {
+		CommandBuffer* self = this;
+		commands::Stats stats;
+		detail::playback(reg, std::span<CommandBuffer* const>(&self, 1), stats);
+		return stats;
+	}
+
+	void CommandBuffer::clear() {
+		m_creates.clear();
+		m_destroys.clear();
+		m_created.clear();
+		for (auto& column : m_columns)
+			if (column) column->clear();
+		m_sequence = 0;
+		m_count = 0;
+	}
+
+	namespace commands {
+
+		CommandBuffer& local() {
+			thread_local CommandBuffer* t_buffer = nullptr;
+			if (!t_buffer) {
+				auto buffer = std::make_unique<CommandBuffer>();
+				std::lock_guard lock(s_buffers_mutex);
+				t_buffer = buffer.get();
+				s_buffers.push_back(std::move(buffer));
+			}
+			return *t_buffer;
+		}
+
+		void flush(Registry& reg) {
+			{
+				std::lock_guard lock(s_buffers_mutex);
+				s_flush_list.clear();
+				for (const auto& buf : s_buffers)
+					if (!buf->empty()) s_flush_list.push_back(buf.get());
+			}
+
+			// Nothing recorded: keep the last real flush's stats readable
+			if (s_flush_list.empty()) return;
+			detail::playback(reg, s_flush_list, s_stats);
+		}
+
+		Stats stats() {
+			return s_stats;
+		}
+
+	} // namespace commands
+
+} // namespace me
@@ -0,0 +1,187 @@
+#include "mini-engine-raylib/ecs/serialize.hpp"
+#include "mini-engine-raylib/ecs/components.hpp"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace me::serialize {
+
+	namespace {
+		using namespace me::components;
+
+		std::vector<detail::ComponentOps> s_components;  // Registration order
+		bool s_defaults = false;
+
+		constexpr std::size_t k_flush = 64 * 1024;
+
+		// Shortest round-trip digits, fixed notation in the range nlohmann uses it, and ".0" on integral values so
+		// the number reads back as a float. Non-finite values become null.
+		template <typename F>
+		std::string_view format_number(F v, char (&buf)[64]) {
+			if (!std::isfinite(v)) return "null";
+
+			const F magnitude = std::fabs(v);
+			const auto format = (magnitude == F(0) || (magnitude >= F(1e-4) && magnitude < F(1e15))) ? std::chars_format::fixed : std::chars_format::scientific;
+			char* end = std::to_chars(buf, buf + sizeof(buf) - 2, v, format).ptr;
+			if (std::string_view(buf, end).find_first_of(".e") == std::string_view::npos) {
+				*end++ = '.';
+				*end++ = '0';
+			}
+			return std::string_view(buf, static_cast<std::size_t>(end - buf));
+		}
+
+		void ensure_defaults() {
+			if (s_defaults) return;
+			s_defaults = true;
+
+			register_component<TransformComponent>();
+			register_component<CameraComponent>();
+			register_component<Camera2DComponent>();
+			register_component<MeshRendererComponent>();
+			register_component<SpriteComponent>();
+		}
+	} // namespace
+
+	void detail::register_component(const ComponentOps& ops) {
+		ensure_defaults();
+		for (auto& existing : s_components) {
+			if (std::strcmp(existing.name, ops.name) != 0) continue;
+			existing = ops;
+			return;
+		}
+		s_components.push_back(ops);
+	}
+
+	std::span<const detail::ComponentOps> components() {
+		ensure_defaults();
+		return s_components;
+	}
+
+	// ---------------- JsonWriter ----------------
+
+	void JsonWriter::begin_object() { open('{'); }
+	void JsonWriter::end_object() { close('}'); }
+	void JsonWriter::begin_array() { open('['); }
+	void JsonWriter::end_array() { close(']'); }
+
+	void JsonWriter::key(std::string_view name) {
+		before_value();
+		quoted(name);
+		put(": ");
+		m_after_key = true;
+	}
+
+	void JsonWriter::value(std::nullptr_t) {
+		before_value();
+		put("null");
+	}
+
+	void JsonWriter::value(bool v) {
+		before_value();
+		put(v ? "true" : "false");
+	}
+
+	void JsonWriter::value(std::int64_t v) {
+		before_value();
+		char buf[24];
+		put(std::string_view(buf, std::to_chars(buf, buf + sizeof(buf), v).ptr - buf));
+	}
+
+	void JsonWriter::value(std::uint64_t v) {
+		before_value();
+		char buf[24];
+		put(std::string_view(buf, std::to_chars(buf, buf + sizeof(buf), v).ptr - buf));
+	}
+
+	void JsonWriter::value(float v) {
+		before_value();
+		char buf[64];
+		put(format_number(v, buf));
+	}
+
+	void JsonWriter::value(double v) {
+		before_value();
+		char buf[64];
+		put(format_number(v, buf));
+	}
+
+	void JsonWriter::value(std::string_view v) {
+		before_value();
+		quoted(v);
+	}
+
+	void JsonWriter::quoted(std::string_view v) {
+		put('"');
+		std::size_t run = 0;   // Start of the pending run of characters that need no escape
+		for (std::size_t i = 0; i < v.size(); ++i) {
+			const unsigned char c = static_cast<unsigned char>(v[i]);
+			if (c >= 0x20 && c != '"' && c != '\\') continue;
+
+			put(v.substr(run, i - run));
+			run = i + 1;
+			switch (c) {
+				case '"': put("\\\""); break;
+				case '\\': put("\\\\"); break;
+				case '\n': put("\\n"); break;
+				case '\r': put("\\r"); break;
+				case '\t': put("\\t"); break;
+				case '\b': put("\\b"); break;
+				case '\f': put("\\f"); break;
+				default: {
+					const char hex[] = "0123456789abcdef";
+					const char escaped[] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 15] };
+					put(std::string_view(escaped, sizeof(escaped)));
+				}
+			}
+		}
+		put(v.substr(run));
+		put('"');
+	}
+
+	void JsonWriter::flush() {
+		if (m_buffer.empty()) return;
+		m_out.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+		m_buffer.clear();
+	}
+
+	void JsonWriter::open(char bracket) {
+		before_value();
+		put(bracket);
+		m_counts.push_back(0);
+	}
+
+	void JsonWriter::close(char bracket) {
+		const bool empty = m_counts.back() == 0;
+		m_counts.pop_back();
+		if (!empty) {
+			put('\n');
+			m_buffer.append(m_counts.size() * static_cast<std::size_t>(m_indent), ' ');
+		}
+		put(bracket);
+	}
+
+	// Separator and indentation before an array element or an object key; a value after its key needs neither
+	void JsonWriter::before_value() {
+		if (m_after_key) {
+			m_after_key = false;
+			return;
+		}
+		if (m_counts.empty()) return;
+		if (m_counts.back()++ > 0) put(',');
+		put('\n');
+		m_buffer.append(m_counts.size() * static_cast<std::size_t>(m_indent), ' ');
+	}
+
+	void JsonWriter::put(std::string_view text) {
+		m_buffer.append(text);
+		if (m_buffer.size() >= k_flush) flush();
+	}
+
+	void JsonWriter::put(char c) {
+		m_buffer.push_back(c);
+		if (m_buffer.size() >= k_flush) flush();
+	}
+
+} // namespace me::serialize
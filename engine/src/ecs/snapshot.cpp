@@ -0,0 +1,294 @@
+#include "mini-engine-raylib/ecs/snapshot.hpp"
+#include "mini-engine-raylib/ecs/components.hpp"
+
+#include "mini-engine-raylib/core/profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+namespace me::snapshot {
+
+	namespace {
+		using namespace me::components;
+
+		// Components per delta block
+		constexpr std::size_t k_block = 64;
+
+		std::vector<detail::PoolOps> s_types;  // Registration order
+		bool s_defaults = false;
+		Stats s_stats;
+
+		void ensure_defaults() {
+			if (s_defaults) return;
+			s_defaults = true;
+
+			register_type<TransformComponent>();
+			register_type<ParentComponent>([](ParentComponent& p, const Remap& ids) {
+				if (p.parent != ParentComponent::none) p.parent = ids(p.parent);
+			});
+			register_type<CameraComponent>();
+			register_type<Camera2DComponent>();
+			register_type<MeshRendererComponent>();
+			register_type<SpriteComponent>();
+		}
+
+		std::size_t append(std::vector<std::byte>& out, const void* data, std::size_t size) {
+			const std::size_t offset = out.size();
+			out.resize(offset + size);
+			if (size) std::memcpy(out.data() + offset, data, size);
+			return offset;
+		}
+
+		const detail::PoolOps* find_ops(ComponentTypeId id) {
+			for (const auto& ops : s_types)
+				if (ops.id == id) return &ops;
+			return nullptr;
+		}
+
+		bool same_entities(std::span<const me::entity::entity_id> a, const me::entity::entity_id* b, std::size_t count) {
+			return a.size() == count && (count == 0 || std::memcmp(a.data(), b, count * sizeof(me::entity::entity_id)) == 0);
+		}
+
+		// A snapshot pool with delta blocks applied: its entity order and component bytes
+		struct Resolved {
+			const detail::PoolOps* ops;
+			const me::entity::entity_id* entities;
+			const std::byte* components;
+			std::size_t count;
+		};
+	} // namespace
+
+	void detail::register_pool(const PoolOps& ops) {
+		ensure_defaults();
+		for (auto& existing : s_types) {
+			if (existing.id != ops.id) continue;
+			existing = ops;
+			return;
+		}
+		s_types.push_back(ops);
+	}
+
+	Snapshot capture(Registry& reg) {
+		ME_PROFILE_SCOPE("snapshot::capture");
+		ensure_defaults();
+
+		std::size_t total = 0;
+		for (const auto& ops : s_types) total += ops.entities(reg).size() * (sizeof(me::entity::entity_id) + ops.size);
+
+		Snapshot snap;
+		snap.m_bytes.reserve(total);
+		for (const auto& ops : s_types) {
+			const auto entities = ops.entities(reg);
+			Snapshot::Pool pool;
+			pool.id = ops.id;
+			pool.size = ops.size;
+			pool.count = entities.size();
+			pool.entities = append(snap.m_bytes, entities.data(), entities.size_bytes());
+			pool.components = append(snap.m_bytes, ops.components(reg), pool.count * ops.size);
+			snap.m_pools.push_back(pool);
+			snap.m_component_count += pool.count;
+		}
+		return snap;
+	}
+
+	Snapshot capture_delta(Registry& reg, const Snapshot& base) {
+		if (base.is_delta()) return capture(reg);
+
+		ME_PROFILE_SCOPE("snapshot::capture_delta");
+		ensure_defaults();
+
+		Snapshot snap;
+		snap.m_base = &base;
+		snap.m_base_layout = base.m_layout;
+		for (const auto& ops : s_types) {
+			const auto entities = ops.entities(reg);
+			const std::byte* components = ops.components(reg);
+
+			Snapshot::Pool pool;
+			pool.id = ops.id;
+			pool.size = ops.size;
+			pool.count = entities.size();
+
+			auto it = std::find_if(base.m_pools.begin(), base.m_pools.end(), [&](const Snapshot::Pool& p) { return p.id == ops.id; });
+			const bool comparable = it != base.m_pools.end() &&
+				same_entities(entities, reinterpret_cast<const me::entity::entity_id*>(base.m_bytes.data() + it->entities), it->count);
+
+			if (!comparable) {
+				pool.entities = append(snap.m_bytes, entities.data(), entities.size_bytes());
+				pool.components = append(snap.m_bytes, components, pool.count * ops.size);
+			} else {
+				// Same entities in the same slots: keep the blocks whose bytes differ
+				pool.delta = true;
+				pool.components = snap.m_bytes.size();
+				const std::byte* before = base.m_bytes.data() + it->components;
+				for (std::size_t first = 0; first < pool.count; first += k_block) {
+					const std::size_t bytes = std::min(k_block, pool.count - first) * ops.size;
+					const std::size_t offset = first * ops.size;
+					if (std::memcmp(before + offset, components + offset, bytes) == 0) continue;
+
+					const std::uint32_t block = static_cast<std::uint32_t>(first / k_block);
+					append(snap.m_bytes, &block, sizeof(block));
+					append(snap.m_bytes, components + offset, bytes);
+					++pool.blocks;
+				}
+			}
+			snap.m_pools.push_back(pool);
+			snap.m_component_count += pool.count;
+		}
+		return snap;
+	}
+
+	bool restore(Registry& reg, Snapshot& snapshot) {
+		ME_PROFILE_SCOPE("snapshot::restore");
+		ensure_defaults();
+		s_stats = {};
+
+		// 1. Resolve every pool to entity order + component bytes (delta pools: base bytes with blocks patched in)
+		std::vector<Resolved> pools;
+		std::vector<std::vector<std::byte>> patched;
+		patched.reserve(snapshot.m_pools.size());
+
+		for (const auto& pool : snapshot.m_pools) {
+			const detail::PoolOps* ops = find_ops(pool.id);
+			if (!ops || ops->size != pool.size) continue;
+
+			if (!pool.delta) {
+				pools.push_back({ ops, reinterpret_cast<const me::entity::entity_id*>(snapshot.m_bytes.data() + pool.entities),
+					snapshot.m_bytes.data() + pool.components, pool.count });
+				continue;
+			}
+
+			const Snapshot* base = snapshot.m_base;
+			if (base->m_layout != snapshot.m_base_layout) return false;
+			auto it = std::find_if(base->m_pools.begin(), base->m_pools.end(), [&](const Snapshot::Pool& p) { return p.id == pool.id; });
+			if (it == base->m_pools.end()) return false;
+
+			const std::byte* original = base->m_bytes.data() + it->components;
+			if (pool.blocks == 0) {
+				pools.push_back({ ops, reinterpret_cast<const me::entity::entity_id*>(base->m_bytes.data() + it->entities), original, pool.count });
+				continue;
+			}
+
+			auto& bytes = patched.emplace_back(original, original + pool.count * pool.size);
+			const std::byte* at = snapshot.m_bytes.data() + pool.components;
+			for (std::size_t b = 0; b < pool.blocks; ++b) {
+				std::uint32_t block;
+				std::memcpy(&block, at, sizeof(block));
+				at += sizeof(block);
+
+				const std::size_t first = block * k_block;
+				const std::size_t size = std::min(k_block, pool.count - first) * pool.size;
+				std::memcpy(bytes.data() + first * pool.size, at, size);
+				at += size;
+			}
+			pools.push_back({ ops, reinterpret_cast<const me::entity::entity_id*>(base->m_bytes.data() + it->entities), bytes.data(), pool.count });
+		}
+
+		// 2. Fast path: every pool still holds the same entities in the same order
+		const bool fast = std::all_of(pools.begin(), pools.end(), [&](const Resolved& p) { return same_entities(p.ops->entities(reg), p.entities, p.count); });
+		s_stats.fast_path = fast;
+		if (fast) {
+			for (const auto& p : pools) {
+				if (p.count) std::memcpy(p.ops->components(reg), p.components, p.count * p.ops->size);
+				s_stats.bytes += p.count * p.ops->size;
+			}
+			return true;
+		}
+
+		// 3. Entity lifecycle: destroy what was created since, re-create what was destroyed since
+		std::vector<me::entity::entity_id> wanted;
+		std::vector<me::entity::entity_id> present;
+		for (const auto& p : pools) {
+			wanted.insert(wanted.end(), p.entities, p.entities + p.count);
+			const auto current = p.ops->entities(reg);
+			present.insert(present.end(), current.begin(), current.end());
+		}
+		std::sort(wanted.begin(), wanted.end());
+		wanted.erase(std::unique(wanted.begin(), wanted.end()), wanted.end());
+		std::sort(present.begin(), present.end());
+		present.erase(std::unique(present.begin(), present.end()), present.end());
+
+		std::vector<me::entity::entity_id> extra;
+		std::set_difference(present.begin(), present.end(), wanted.begin(), wanted.end(), std::back_inserter(extra));
+		for (auto e : extra) reg.destroy_entity(e);
+		s_stats.destroyed = extra.size();
+
+		std::unordered_map<me::entity::entity_id, me::entity::entity_id> ids;
+		std::vector<me::entity::entity_id> missing;
+		std::set_difference(wanted.begin(), wanted.end(), present.begin(), present.end(), std::back_inserter(missing));
+		for (auto e : missing) {
+			if (reg.is_alive(e)) continue; // Alive, just without registered components
+			ids[e] = reg.create_entity("Entity");
+			++s_stats.recreated;
+		}
+		const Remap remap(ids);
+
+		// 4. Per pool: match membership, then copy values
+		std::vector<std::byte> value;
+		std::unordered_map<me::entity::entity_id, std::size_t> target;
+		std::vector<me::entity::entity_id> stale;
+
+		for (const auto& p : pools) {
+			const detail::PoolOps& ops = *p.ops;
+			auto load = [&](std::size_t i) {
+				value.assign(p.components + i * ops.size, p.components + (i + 1) * ops.size);
+				if (ops.remap && !ids.empty()) ops.remap(value.data(), remap);
+				return value.data();
+			};
+
+			target.clear();
+			for (std::size_t i = 0; i < p.count; ++i) target.emplace(remap(p.entities[i]), i);
+
+			stale.clear();
+			for (auto e : ops.entities(reg))
+				if (!target.contains(e)) stale.push_back(e);
+			for (auto e : stale) ops.remove(reg, e);
+
+			// Present entities overwrite in place below; missing ones are added with their value
+			std::unordered_map<me::entity::entity_id, std::size_t> slot;
+			const auto current = ops.entities(reg);
+			for (std::size_t j = 0; j < current.size(); ++j) slot.emplace(current[j], j);
+			for (const auto& [e, i] : target)
+				if (!slot.contains(e)) ops.add(reg, e, load(i));
+
+			const auto entities = ops.entities(reg);
+			std::byte* components = ops.components(reg);
+			for (std::size_t j = 0; j < entities.size(); ++j) {
+				auto it = target.find(entities[j]);
+				if (it == target.end()) continue;
+				std::memcpy(components + j * ops.size, load(it->second), ops.size);
+			}
+			s_stats.bytes += p.count * ops.size;
+		}
+
+		// 5. Same values, new ids and order: re-lay the snapshot out so the next restore takes the fast path
+		if (!snapshot.is_delta()) {
+			std::vector<std::byte> bytes;
+			bytes.reserve(snapshot.m_bytes.size());
+			for (auto& pool : snapshot.m_pools) {
+				const detail::PoolOps* ops = find_ops(pool.id);
+				if (!ops || ops->size != pool.size) {
+					pool.entities = append(bytes, snapshot.m_bytes.data() + pool.entities, pool.count * sizeof(me::entity::entity_id));
+					pool.components = append(bytes, snapshot.m_bytes.data() + pool.components, pool.count * pool.size);
+					continue;
+				}
+
+				const auto entities = ops->entities(reg);
+				pool.count = entities.size();
+				pool.entities = append(bytes, entities.data(), entities.size_bytes());
+				pool.components = append(bytes, ops->components(reg), pool.count * pool.size);
+			}
+			snapshot.m_bytes = std::move(bytes);
+			++snapshot.m_layout;
+		}
+		return true;
+	}
+
+	Stats stats() {
+		return s_stats;
+	}
+
+} // namespace me::snapshot
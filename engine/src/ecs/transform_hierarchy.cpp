@@ -0,0 +1,263 @@
+#include "mini-engine-raylib/ecs/transform_system.hpp"
+#include "transform_internal.hpp"
+
+#include "mini-engine-raylib/core/engine.hpp"
+#include "mini-engine-raylib/core/frame_arena.hpp"
+#include "mini-engine-raylib/core/jobs.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+namespace me::transform {
+
+	namespace {
+		using me::components::ParentComponent;
+		using me::components::TransformComponent;
+
+		// Root subtrees per propagation job
+		constexpr std::size_t k_group_grain = 64;
+
+		// An entity with a parent or children. Stored in s_nodes so that every root subtree is one
+		// contiguous range and parents always come before their children.
+		struct Node {
+			me::entity::entity_id entity;
+			me::entity::entity_id parent_entity;    // ParentComponent::none for roots
+			std::int32_t parent;                    // Index into s_nodes, -1 for roots
+			std::size_t slot;                       // TransformComponent pool slot
+			std::size_t link;                       // ParentComponent pool slot (children only)
+			Matrix local;                           // Children only: matrix of their own TransformComponent
+		};
+
+		const Registry* s_owner = nullptr;
+		std::vector<Node> s_nodes;
+		std::vector<std::size_t> s_groups;          // Start of each root subtree in s_nodes, plus the end
+		std::size_t s_link_count = 0;               // ParentComponent pool size the nodes were built from
+		bool s_rebuild = true;
+
+		// Rebuilds s_nodes from the ParentComponent pool. Runs only when the structure changed.
+		void rebuild(Registry& reg, Matrix* matrices, std::size_t n) {
+			ME_PROFILE_SCOPE("transform::rebuild_hierarchy");
+
+			auto& pool = reg.view<TransformComponent>();
+			auto& links = reg.view<ParentComponent>();
+			const TransformComponent* base = pool.components.data();
+
+			// Former children are world space again unless they are re-added below
+			for (const Node& node : s_nodes) {
+				if (node.parent >= 0 && node.slot < n && pool.entity_map[node.slot] == node.entity)
+					internal_compose_matrix(pool.components[node.slot], matrices[node.slot].m);
+			}
+
+			std::vector<Node> nodes;
+			std::unordered_map<me::entity::entity_id, std::int32_t> index;
+
+			auto add_node = [&](me::entity::entity_id e, std::size_t slot) {
+				auto [it, inserted] = index.try_emplace(e, static_cast<std::int32_t>(nodes.size()));
+				if (inserted) nodes.push_back({ e, ParentComponent::none, -1, slot, 0, {} });
+				return it->second;
+			};
+
+			// 1. Children with a live, transformed parent, then the parents themselves
+			for (std::size_t i = 0; i < links.size(); ++i) {
+				const me::entity::entity_id child = links.entity_map[i];
+				const me::entity::entity_id parent = links.components[i].parent;
+				if (parent == ParentComponent::none || parent == child || !reg.is_alive(parent)) continue;
+
+				const auto* ct = reg.try_get_component<TransformComponent>(child);
+				const auto* pt = reg.try_get_component<TransformComponent>(parent);
+				if (!ct || !pt) continue;
+
+				const std::int32_t c = add_node(child, static_cast<std::size_t>(ct - base));
+				nodes[c].parent_entity = parent;
+				nodes[c].link = i;
+			}
+
+			const std::size_t child_count = nodes.size();
+			for (std::size_t c = 0; c < child_count; ++c) {
+				const me::entity::entity_id parent = nodes[c].parent_entity;
+				if (parent == ParentComponent::none) continue;
+				const std::int32_t p = add_node(parent, static_cast<std::size_t>(reg.try_get_component<TransformComponent>(parent) - base));
+				nodes[c].parent = p;
+			}
+
+			// 2. Depth and root of every node (memoized, each node resolved once; cycles are cut into roots)
+			const std::size_t count = nodes.size();
+			std::vector<std::int32_t> depth(count, -1);
+			std::vector<std::int32_t> root(count, -1);
+			std::vector<std::uint8_t> on_stack(count, 0);
+			std::vector<std::int32_t> stack;
+
+			for (std::size_t i = 0; i < count; ++i) {
+				std::int32_t at = static_cast<std::int32_t>(i);
+				while (depth[at] < 0 && nodes[at].parent >= 0 && !on_stack[at]) {
+					on_stack[at] = 1;
+					stack.push_back(at);
+					at = nodes[at].parent;
+				}
+
+				if (depth[at] < 0) {
+					if (on_stack[at]) {
+						nodes[at].parent = -1; // Cycle: break it here
+						stack.erase(std::find(stack.begin(), stack.end(), at));
+					}
+					depth[at] = 0;
+					root[at] = at;
+				}
+
+				while (!stack.empty()) {
+					const std::int32_t child = stack.back();
+					stack.pop_back();
+					on_stack[child] = 0;
+					depth[child] = depth[nodes[child].parent] + 1;
+					root[child] = root[nodes[child].parent];
+				}
+			}
+
+			// 3. Order: root subtree, then depth, so one forward pass sees parents first
+			std::vector<std::int32_t> order(count);
+			std::iota(order.begin(), order.end(), 0);
+			std::stable_sort(order.begin(), order.end(), [&](std::int32_t a, std::int32_t b) {
+				if (root[a] != root[b]) return root[a] < root[b];
+				return depth[a] < depth[b];
+			});
+
+			std::vector<std::int32_t> remap(count);
+			for (std::size_t i = 0; i < count; ++i) remap[order[i]] = static_cast<std::int32_t>(i);
+
+			s_nodes.clear();
+			s_nodes.reserve(count);
+			s_groups.clear();
+			for (std::size_t i = 0; i < count; ++i) {
+				Node node = nodes[order[i]];
+				if (node.parent >= 0) node.parent = remap[node.parent];
+				if (i == 0 || root[order[i]] != root[order[i - 1]]) s_groups.push_back(i);
+
+				// Every child starts from its current transform
+				if (node.parent >= 0) internal_compose_matrix(pool.components[node.slot], node.local.m);
+				s_nodes.push_back(node);
+			}
+			s_groups.push_back(count);
+
+			s_link_count = links.size();
+		}
+
+		// Structure still matches the registry? Also refreshes pool slots that moved.
+		bool validate(Registry& reg, std::size_t n) {
+			auto& pool = reg.view<TransformComponent>();
+			auto& links = reg.view<ParentComponent>();
+			if (links.size() != s_link_count) return false;
+
+			const TransformComponent* base = pool.components.data();
+			for (Node& node : s_nodes) {
+				if (node.slot >= n || pool.entity_map[node.slot] != node.entity) {
+					const auto* t = reg.try_get_component<TransformComponent>(node.entity);
+					if (!t) return false;
+					node.slot = static_cast<std::size_t>(t - base);
+				}
+				if (node.parent >= 0) {
+					if (node.link >= links.size() || links.entity_map[node.link] != node.entity) return false;
+					if (links.components[node.link].parent != node.parent_entity) return false;
+				}
+			}
+			return true;
+		}
+	} // namespace
+
+	std::size_t internal_propagate_hierarchy(Registry& reg, Matrix* matrices, const std::uint8_t* dirty, std::uint8_t* parented, std::size_t n) {
+		if (s_owner != &reg) {
+			s_owner = &reg;
+			s_nodes.clear();
+			s_rebuild = true;
+		}
+
+		// Nothing parented and nothing to undo: flat scenes pay only this check
+		auto& links = reg.view<ParentComponent>();
+		if (links.size() == 0 && s_nodes.empty()) {
+			s_link_count = 0;
+			return 0;
+		}
+
+		ME_PROFILE_SCOPE("transform::propagate");
+		std::fill(parented, parented + n, std::uint8_t{ 0 });
+
+		const bool rebuilt = s_rebuild || !validate(reg, n);
+		if (rebuilt) {
+			rebuild(reg, matrices, n);
+			s_rebuild = false;
+		}
+
+		// A node's world matrix changes if its own transform or any ancestor's did
+		auto world_dirty = me::frame_arena().allocate_array<std::uint8_t>(s_nodes.size());
+		std::atomic<std::size_t> recomputed{ 0 };
+
+		// Root subtrees don't share nodes, so they propagate in parallel
+		const std::size_t group_count = s_groups.empty() ? 0 : s_groups.size() - 1;
+		me::jobs::parallel_for_chunks(0, group_count, k_group_grain, [&](std::size_t first_group, std::size_t last_group) {
+			std::size_t count = 0;
+			for (std::size_t k = s_groups[first_group]; k < s_groups[last_group]; ++k) {
+				Node& node = s_nodes[k];
+
+				if (node.parent < 0) {
+					// Roots: the cached matrix is already their world matrix
+					world_dirty[k] = rebuilt || dirty[node.slot];
+					continue;
+				}
+
+				if (dirty[node.slot]) node.local = matrices[node.slot];
+				world_dirty[k] = rebuilt || dirty[node.slot] || world_dirty[node.parent];
+				parented[node.slot] = 1;
+
+				if (world_dirty[k]) {
+					internal_multiply(matrices[s_nodes[node.parent].slot], node.local, matrices[node.slot]);
+					++count;
+				}
+			}
+			recomputed.fetch_add(count, std::memory_order_relaxed);
+		});
+
+		return recomputed.load(std::memory_order_relaxed);
+	}
+
+	void internal_mark_hierarchy_dirty() {
+		s_rebuild = true;
+	}
+
+	std::size_t internal_hierarchy_size() {
+		return s_nodes.size();
+	}
+
+	bool set_parent(me::entity::entity_id child, me::entity::entity_id parent) {
+		Registry& reg = me::get_registry();
+		if (child == parent || !reg.is_alive(child) || !reg.is_alive(parent)) return false;
+
+		// Refuse cycles: parent must not already hang below child
+		const std::size_t max_depth = reg.view<ParentComponent>().size();
+		me::entity::entity_id e = parent;
+		for (std::size_t steps = 0; steps <= max_depth; ++steps) {
+			const auto* link = reg.try_get_component<ParentComponent>(e);
+			if (!link || link->parent == ParentComponent::none) break;
+			if (link->parent == child) return false;
+			e = link->parent;
+		}
+
+		if (auto* link = reg.try_get_component<ParentComponent>(child)) link->parent = parent;
+		else reg.add_component(child, ParentComponent{ parent });
+
+		internal_mark_hierarchy_dirty();
+		return true;
+	}
+
+	void clear_parent(me::entity::entity_id child) {
+		Registry& reg = me::get_registry();
+		if (auto* link = reg.try_get_component<ParentComponent>(child)) {
+			link->parent = ParentComponent::none;
+			internal_mark_hierarchy_dirty();
+		}
+	}
+
+} // namespace me::transform
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "mini-engine-raylib/ecs/transform_system.hpp"
+
+#include <mini-ecs/registry.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace me::transform {
+
+	// Internal-only: update() on any registry (render extraction and benchmarks pass their own)
+	void internal_update(Registry& reg);
+
+	// Internal-only: internal_update() unless it already ran this tick (changes::tick()) on the same pool layout.
+	// The cache is then as of that update: values written since show up at the next one. For readers of the
+	// cached state (render extraction, spatial, change ticks), so a frame scans the transforms once.
+	void internal_refresh(Registry& reg);
+
+	// Internal-only: called by the engine once per frame after on_update. Updates the cache once anything used it.
+	void internal_frame_update(Registry& reg);
+
+	// Internal-only: cached matrices indexed like the TransformComponent pool of the registry last passed
+	// to internal_update(). Only valid until that pool changes.
+	const Matrix* internal_world_matrices();
+
+	// Internal-only: second half of internal_update(). `matrices` (pool-indexed) holds a fresh local matrix
+	// wherever `dirty` is set and last update's world matrix elsewhere; children are turned into world space.
+	// Sets `parented` for every slot whose matrix includes a parent. Returns the number of re-multiplied nodes.
+	std::size_t internal_propagate_hierarchy(Registry& reg, Matrix* matrices, const std::uint8_t* dirty, std::uint8_t* parented, std::size_t n);
+
+	// Internal-only: forces a hierarchy rebuild on the next update (after set_parent/clear_parent)
+	void internal_mark_hierarchy_dirty();
+
+	// Internal-only: number of entities in the hierarchy as of the last update
+	std::size_t internal_hierarchy_size();
+
+	// Internal-only: per pool slot, 1 if the cached matrix includes a parent (valid like internal_world_matrices)
+	const std::uint8_t* internal_parented();
+
+	// out = a * b (column-major)
+	void internal_multiply(const Matrix& a, const Matrix& b, Matrix& out);
+
+	// Reference (scalar) matrix of one transform
+	void internal_compose_matrix(const me::components::TransformComponent& t, float out[16]);
+
+	// Matrices of `count` transforms, SSE over groups of 4 when available (sin/cos included)
+	void internal_compose_matrices(const me::components::TransformComponent* const* transforms, Matrix* const* out, std::size_t count);
+
+} // namespace me::transform
@@ -0,0 +1,416 @@
+#include "mini-engine-raylib/ecs/transform_system.hpp"
+#include "transform_internal.hpp"
+
+#include "mini-engine-raylib/core/engine.hpp"
+#include "mini-engine-raylib/core/jobs.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+#include "mini-engine-raylib/ecs/changes.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ME_TRANSFORM_SSE 1
+#include <emmintrin.h>
+#else
+#define ME_TRANSFORM_SSE 0
+#endif
+
+namespace me::transform {
+
+	namespace {
+		using me::components::TransformComponent;
+
+		// SoA chunks per update job (4096 transforms)
+		constexpr std::size_t k_update_grain = 4096 / TransformSoa::chunk_size;
+		static_assert(TransformSoa::chunk_size <= 64, "update() keeps one dirty bit per lane in a 64-bit mask");
+
+		// SoA rows
+		constexpr std::size_t k_x = TransformSoa::index_of(&TransformComponent::x);
+		constexpr std::size_t k_y = TransformSoa::index_of(&TransformComponent::y);
+		constexpr std::size_t k_z = TransformSoa::index_of(&TransformComponent::z);
+		constexpr std::size_t k_rot_x = TransformSoa::index_of(&TransformComponent::rot_x);
+		constexpr std::size_t k_rot_y = TransformSoa::index_of(&TransformComponent::rot_y);
+		constexpr std::size_t k_rot_z = TransformSoa::index_of(&TransformComponent::rot_z);
+		constexpr std::size_t k_sx = TransformSoa::index_of(&TransformComponent::sx);
+		constexpr std::size_t k_sy = TransformSoa::index_of(&TransformComponent::sy);
+		constexpr std::size_t k_sz = TransformSoa::index_of(&TransformComponent::sz);
+		constexpr auto& k_fields = me::SoaLayout<TransformComponent>::fields;
+
+		constexpr me::entity::entity_id k_no_entity = std::numeric_limits<me::entity::entity_id>::max();
+
+		constexpr float k_deg2rad = 3.14159265358979323846f / 180.0f;
+
+		// Cache indexed like the TransformComponent pool. A slot is dirty when its entity or its
+		// transform differ from what the matrix was built from (pool swaps and writes look the same).
+		// The sources are kept as SoA so dirty quads compose straight from aligned rows, plus an AoS
+		// copy laid out like the pool so an unchanged chunk is one memcmp.
+		const Registry* s_owner = nullptr;
+		std::vector<me::entity::entity_id> s_entities;
+		TransformSoa s_sources;
+		std::vector<TransformComponent> s_compared;
+		std::vector<Matrix> s_matrices;
+		std::vector<std::uint8_t> s_dirty;       // Local matrix rebuilt this update
+		std::vector<std::uint64_t> s_written;    // Serial of the last update that found the slot dirty (change ticks)
+		std::uint64_t s_serial = 0;
+		changes::Tick s_updated_tick = 0;        // changes::tick() of the last update (valid once s_serial > 0)
+		std::vector<std::uint8_t> s_parented;
+		Stats s_stats;
+
+#if ME_TRANSFORM_SSE
+		// Cephes-style sin/cos of 4 angles in radians, |error| < 1e-6 on [-pi, pi]
+		void sincos_ps(__m128 x, __m128& out_sin, __m128& out_cos) {
+			const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000u)));
+
+			__m128 sign_sin = _mm_and_ps(x, sign_mask);
+			x = _mm_andnot_ps(sign_mask, x);
+
+			// Octant: j = (int(x * 4/pi) + 1) & ~1
+			__m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+			j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+			const __m128 y = _mm_cvtepi32_ps(j);
+
+			const __m128 swap_sign_sin = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+			const __m128 poly_mask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+			const __m128 sign_cos = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+			sign_sin = _mm_xor_ps(sign_sin, swap_sign_sin);
+
+			// x -= y * pi/4 in three parts (extended precision)
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-0.78515625f)));
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-2.4187564849853515625e-4f)));
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-3.77489497744594108e-8f)));
+
+			const __m128 z = _mm_mul_ps(x, x);
+
+			__m128 poly_cos = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(2.443315711809948e-5f), z), _mm_set1_ps(-1.388731625493765e-3f));
+			poly_cos = _mm_add_ps(_mm_mul_ps(poly_cos, z), _mm_set1_ps(4.166664568298827e-2f));
+			poly_cos = _mm_mul_ps(_mm_mul_ps(poly_cos, z), z);
+			poly_cos = _mm_add_ps(_mm_sub_ps(poly_cos, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+
+			__m128 poly_sin = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-1.9515295891e-4f), z), _mm_set1_ps(8.3321608736e-3f));
+			poly_sin = _mm_add_ps(_mm_mul_ps(poly_sin, z), _mm_set1_ps(-1.6666654611e-1f));
+			poly_sin = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(poly_sin, z), x), x);
+
+			// Octants 1,2 (mod 4) swap the polynomials
+			const __m128 s = _mm_or_ps(_mm_and_ps(poly_mask, poly_sin), _mm_andnot_ps(poly_mask, poly_cos));
+			const __m128 c = _mm_or_ps(_mm_and_ps(poly_mask, poly_cos), _mm_andnot_ps(poly_mask, poly_sin));
+			out_sin = _mm_xor_ps(s, sign_sin);
+			out_cos = _mm_xor_ps(c, sign_cos);
+		}
+
+		// Degrees -> radians in [-pi, pi], so large accumulated angles keep their precision
+		__m128 wrap_radians(__m128 degrees) {
+			const __m128 turns = _mm_mul_ps(degrees, _mm_set1_ps(1.0f / 360.0f));
+			const __m128 whole = _mm_cvtepi32_ps(_mm_cvtps_epi32(turns)); // Round to nearest
+			return _mm_mul_ps(_mm_sub_ps(degrees, _mm_mul_ps(whole, _mm_set1_ps(360.0f))), _mm_set1_ps(k_deg2rad));
+		}
+
+		// Same math as internal_compose_matrix, one transform per lane. load(row) returns that field of the 4 transforms.
+		template <typename Load>
+		void compose4(const Load& load, Matrix* const* out) {
+			const __m128 x = load(k_x);
+			const __m128 y = load(k_y);
+			const __m128 z = load(k_z);
+			const __m128 sx = load(k_sx);
+			const __m128 sy = load(k_sy);
+			const __m128 sz = load(k_sz);
+
+			__m128 sa, ca, sb, cb, sc, cc;
+			sincos_ps(wrap_radians(load(k_rot_x)), sa, ca);
+			sincos_ps(wrap_radians(load(k_rot_y)), sb, cb);
+			sincos_ps(wrap_radians(load(k_rot_z)), sc, cc);
+
+			const __m128 sb_sa = _mm_mul_ps(sb, sa);
+			const __m128 sb_ca = _mm_mul_ps(sb, ca);
+
+			// Columns of R = Rz * Ry * Rx, scaled by sx/sy/sz
+			__m128 c0x = _mm_mul_ps(_mm_mul_ps(cc, cb), sx);
+			__m128 c0y = _mm_mul_ps(_mm_mul_ps(sc, cb), sx);
+			__m128 c0z = _mm_mul_ps(_mm_sub_ps(_mm_setzero_ps(), sb), sx);
+			__m128 c0w = _mm_setzero_ps();
+
+			__m128 c1x = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(cc, sb_sa), _mm_mul_ps(sc, ca)), sy);
+			__m128 c1y = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(sc, sb_sa), _mm_mul_ps(cc, ca)), sy);
+			__m128 c1z = _mm_mul_ps(_mm_mul_ps(cb, sa), sy);
+			__m128 c1w = _mm_setzero_ps();
+
+			__m128 c2x = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(cc, sb_ca), _mm_mul_ps(sc, sa)), sz);
+			__m128 c2y = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(sc, sb_ca), _mm_mul_ps(cc, sa)), sz);
+			__m128 c2z = _mm_mul_ps(_mm_mul_ps(cb, ca), sz);
+			__m128 c2w = _mm_setzero_ps();
+
+			__m128 c3x = x, c3y = y, c3z = z;
+			__m128 c3w = _mm_set1_ps(1.0f);
+
+			// Lanes -> matrices: after each transpose register i holds one column of transform i
+			_MM_TRANSPOSE4_PS(c0x, c0y, c0z, c0w);
+			_MM_TRANSPOSE4_PS(c1x, c1y, c1z, c1w);
+			_MM_TRANSPOSE4_PS(c2x, c2y, c2z, c2w);
+			_MM_TRANSPOSE4_PS(c3x, c3y, c3z, c3w);
+
+			const __m128 col0[4] = { c0x, c0y, c0z, c0w };
+			const __m128 col1[4] = { c1x, c1y, c1z, c1w };
+			const __m128 col2[4] = { c2x, c2y, c2z, c2w };
+			const __m128 col3[4] = { c3x, c3y, c3z, c3w };
+			for (int i = 0; i < 4; ++i) {
+				_mm_storeu_ps(out[i]->m + 0, col0[i]);
+				_mm_storeu_ps(out[i]->m + 4, col1[i]);
+				_mm_storeu_ps(out[i]->m + 8, col2[i]);
+				_mm_storeu_ps(out[i]->m + 12, col3[i]);
+			}
+		}
+#endif
+
+		static_assert(sizeof(TransformComponent) == 9 * sizeof(float), "The dirty check memcmps transforms, so they can't have padding");
+
+		template <std::size_t... F>
+		void store_source(TransformSoa::Chunk& chunk, std::size_t lane, const TransformComponent& t, std::index_sequence<F...>) {
+			((chunk.rows[F][lane] = t.*k_fields[F]), ...);
+		}
+
+		void store_source(TransformSoa::Chunk& chunk, std::size_t lane, const TransformComponent& t) {
+			store_source(chunk, lane, t, std::make_index_sequence<k_fields.size()>{});
+		}
+
+		// Dirty lanes that don't fill a whole quad, composed 4 at a time from wherever they are
+		struct Pending {
+			const TransformSoa::Chunk* chunk[4];
+			std::size_t lane[4];
+			Matrix* target[4];
+			std::size_t count = 0;
+
+			void flush() {
+#if ME_TRANSFORM_SSE
+				if (count == 4) {
+					compose4([&](std::size_t f) {
+						return _mm_setr_ps(chunk[0]->rows[f][lane[0]], chunk[1]->rows[f][lane[1]], chunk[2]->rows[f][lane[2]], chunk[3]->rows[f][lane[3]]);
+					}, target);
+					count = 0;
+					return;
+				}
+#endif
+				for (std::size_t k = 0; k < count; ++k) {
+					TransformComponent t;
+					for (std::size_t f = 0; f < k_fields.size(); ++f) t.*k_fields[f] = chunk[k]->rows[f][lane[k]];
+					internal_compose_matrix(t, target[k]->m);
+				}
+				count = 0;
+			}
+
+			void push(const TransformSoa::Chunk& c, std::size_t l, Matrix& m) {
+				chunk[count] = &c;
+				lane[count] = l;
+				target[count] = &m;
+				if (++count == 4) flush();
+			}
+		};
+	} // namespace
+
+	void internal_compose_matrix(const TransformComponent& t, float out[16]) {
+		const float sa = std::sin(t.rot_x * k_deg2rad), ca = std::cos(t.rot_x * k_deg2rad);
+		const float sb = std::sin(t.rot_y * k_deg2rad), cb = std::cos(t.rot_y * k_deg2rad);
+		const float sc = std::sin(t.rot_z * k_deg2rad), cc = std::cos(t.rot_z * k_deg2rad);
+
+		// R = Rz * Ry * Rx, columns scaled by sx/sy/sz
+		out[0] = cc * cb * t.sx;
+		out[1] = sc * cb * t.sx;
+		out[2] = -sb * t.sx;
+		out[3] = 0.0f;
+
+		out[4] = (cc * sb * sa - sc * ca) * t.sy;
+		out[5] = (sc * sb * sa + cc * ca) * t.sy;
+		out[6] = cb * sa * t.sy;
+		out[7] = 0.0f;
+
+		out[8] = (cc * sb * ca + sc * sa) * t.sz;
+		out[9] = (sc * sb * ca - cc * sa) * t.sz;
+		out[10] = cb * ca * t.sz;
+		out[11] = 0.0f;
+
+		out[12] = t.x;
+		out[13] = t.y;
+		out[14] = t.z;
+		out[15] = 1.0f;
+	}
+
+	void internal_multiply(const Matrix& a, const Matrix& b, Matrix& out) {
+#if ME_TRANSFORM_SSE
+		const __m128 a0 = _mm_loadu_ps(a.m + 0), a1 = _mm_loadu_ps(a.m + 4), a2 = _mm_loadu_ps(a.m + 8), a3 = _mm_loadu_ps(a.m + 12);
+		__m128 cols[4];
+		for (int j = 0; j < 4; ++j) {
+			const float* bj = b.m + j * 4;
+			cols[j] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(bj[0])), _mm_mul_ps(a1, _mm_set1_ps(bj[1]))),
+				_mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(bj[2])), _mm_mul_ps(a3, _mm_set1_ps(bj[3]))));
+		}
+		for (int j = 0; j < 4; ++j) _mm_storeu_ps(out.m + j * 4, cols[j]);
+#else
+		Matrix r;
+		for (int j = 0; j < 4; ++j)
+			for (int i = 0; i < 4; ++i)
+				r.m[j * 4 + i] = a.m[i] * b.m[j * 4] + a.m[4 + i] * b.m[j * 4 + 1] + a.m[8 + i] * b.m[j * 4 + 2] + a.m[12 + i] * b.m[j * 4 + 3];
+		out = r;
+#endif
+	}
+
+	void internal_compose_matrices(const TransformComponent* const* transforms, Matrix* const* out, std::size_t count) {
+		std::size_t i = 0;
+#if ME_TRANSFORM_SSE
+		for (; i + 4 <= count; i += 4) {
+			const TransformComponent* const* t = transforms + i;
+			compose4([&](std::size_t f) { return _mm_setr_ps(t[0]->*k_fields[f], t[1]->*k_fields[f], t[2]->*k_fields[f], t[3]->*k_fields[f]); }, out + i);
+		}
+#endif
+		for (; i < count; ++i)
+			internal_compose_matrix(*transforms[i], out[i]->m);
+	}
+
+	void internal_update(Registry& reg) {
+		ME_PROFILE_SCOPE("transform::update");
+
+		auto& pool = reg.view<TransformComponent>();
+		const std::size_t n = pool.size();
+
+		// Another registry: nothing cached is valid
+		if (s_owner != &reg) {
+			s_owner = &reg;
+			s_entities.clear();
+		}
+		s_entities.resize(n, k_no_entity);
+		s_sources.resize(n);
+		s_compared.resize(n);
+		s_matrices.resize(n);
+		s_dirty.resize(n);
+		s_written.resize(n);
+		s_parented.resize(n);
+
+		const std::uint64_t serial = ++s_serial;
+		s_updated_tick = changes::tick();
+		std::atomic<std::size_t> recomputed{ 0 };
+
+		// Jobs own whole SoA chunks
+		me::jobs::parallel_for_chunks(0, s_sources.chunk_count(), k_update_grain, [&](std::size_t first_chunk, std::size_t last_chunk) {
+			Pending pending;
+			std::size_t dirty = 0;
+
+			for (std::size_t c = first_chunk; c < last_chunk; ++c) {
+				TransformSoa::Chunk& chunk = s_sources.chunk(c);
+				const std::size_t base = c * TransformSoa::chunk_size;
+				const std::size_t length = s_sources.chunk_length(c);
+
+				// 1. Copy written transforms into the rows. Bitwise, like a memcmp (NaN and -0 count as writes);
+				// most chunks are unchanged and stop at the first compare.
+				const TransformComponent* transforms = pool.components.data() + base;
+				const me::entity::entity_id* entities = pool.entity_map.data() + base;
+				if (std::memcmp(transforms, s_compared.data() + base, length * sizeof(TransformComponent)) == 0 &&
+					std::memcmp(entities, s_entities.data() + base, length * sizeof(me::entity::entity_id)) == 0) {
+					std::fill_n(s_dirty.begin() + static_cast<std::ptrdiff_t>(base), length, std::uint8_t{ 0 });
+					continue;
+				}
+
+				std::uint64_t mask = 0;
+				for (std::size_t l = 0; l < length; ++l) {
+					const std::size_t i = base + l;
+					const TransformComponent& t = transforms[l];
+					const bool same = s_entities[i] == entities[l] && std::memcmp(&t, &s_compared[i], sizeof(TransformComponent)) == 0;
+					s_dirty[i] = !same;
+					if (same) continue;
+
+					s_entities[i] = entities[l];
+					s_written[i] = serial;
+					s_compared[i] = t;
+					store_source(chunk, l, t);
+					mask |= std::uint64_t{ 1 } << l;
+				}
+				if (mask == 0) continue;
+				dirty += static_cast<std::size_t>(std::popcount(mask));
+
+				// 2. A fully dirty quad composes from aligned loads; partial ones queue up
+				for (std::size_t quad = 0; quad < length; quad += 4) {
+					const unsigned bits = static_cast<unsigned>(mask >> quad) & 0xF;
+					if (bits == 0) continue;
+#if ME_TRANSFORM_SSE
+					if (bits == 0xF) {
+						Matrix* targets[4] = { &s_matrices[base + quad], &s_matrices[base + quad + 1], &s_matrices[base + quad + 2], &s_matrices[base + quad + 3] };
+						compose4([&](std::size_t f) { return _mm_load_ps(chunk.rows[f] + quad); }, targets);
+						continue;
+					}
+#endif
+					for (std::size_t l = 0; l < 4; ++l)
+						if (bits & (1u << l)) pending.push(chunk, quad + l, s_matrices[base + quad + l]);
+				}
+			}
+			pending.flush();
+			recomputed.fetch_add(dirty, std::memory_order_relaxed);
+		});
+
+		// Children: local -> world, in depth order
+		s_stats.hierarchy_recomputed = internal_propagate_hierarchy(reg, s_matrices.data(), s_dirty.data(), s_parented.data(), n);
+		s_stats.hierarchy_nodes = internal_hierarchy_size();
+
+		s_stats.transforms = n;
+		s_stats.recomputed = recomputed.load(std::memory_order_relaxed);
+		ME_PROFILE_COUNTER("transform::recomputed", s_stats.recomputed);
+		ME_PROFILE_COUNTER("transform::hierarchy_recomputed", s_stats.hierarchy_recomputed);
+	}
+
+	void internal_refresh(Registry& reg) {
+		// Same entity in every slot: the cached matrices still line up with the pool
+		auto& pool = reg.view<TransformComponent>();
+		const std::size_t n = pool.size();
+		if (s_owner == &reg && s_serial > 0 && s_updated_tick == changes::tick() && s_entities.size() == n &&
+			(n == 0 || std::memcmp(pool.entity_map.data(), s_entities.data(), n * sizeof(me::entity::entity_id)) == 0))
+			return;
+		internal_update(reg);
+	}
+
+	void internal_frame_update(Registry& reg) {
+		if (s_owner) internal_update(reg);
+	}
+
+	const Matrix* internal_world_matrices() {
+		return s_matrices.data();
+	}
+
+	const TransformSoa& soa() {
+		return s_sources;
+	}
+
+	const std::uint8_t* internal_parented() {
+		return s_parented.data();
+	}
+
+	void update() {
+		internal_update(me::get_registry());
+	}
+
+	const Matrix* world_matrix(me::entity::entity_id e) {
+		Registry& reg = me::get_registry();
+		const auto* t = reg.try_get_component<TransformComponent>(e);
+		if (!t || s_owner != &reg) return nullptr;
+
+		const std::size_t slot = static_cast<std::size_t>(t - reg.view<TransformComponent>().components.data());
+		if (slot >= s_matrices.size() || s_entities[slot] != e) return nullptr;
+		return &s_matrices[slot];
+	}
+
+	Stats stats() {
+		return s_stats;
+	}
+
+} // namespace me::transform
+
+namespace me::changes {
+
+	WrittenSlots WriteSource<me::components::TransformComponent>::scan(Registry& reg) {
+		me::transform::internal_refresh(reg);
+		return { me::transform::s_entities, me::transform::s_written, me::transform::s_serial };
+	}
+
+} // namespace me::changes
@@ -0,0 +1,54 @@
+#include "mini-engine-raylib/ecs/type_id.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+#if __has_include(<cxxabi.h>)
+#define ME_HAS_CXXABI 1
+#include <cxxabi.h>
+#else
+#define ME_HAS_CXXABI 0
+#endif
+
+namespace me {
+
+	namespace {
+		std::string readable(const char* raw) {
+#if ME_HAS_CXXABI
+			int status = 0;
+			char* demangled = abi::__cxa_demangle(raw, nullptr, nullptr, &status);
+			if (status == 0 && demangled) {
+				std::string name(demangled);
+				std::free(demangled);
+				return name;
+			}
+			std::free(demangled);
+#endif
+			// MSVC names are readable already, with a "class "/"struct " prefix
+			std::string name(raw);
+			for (const char* prefix : { "class ", "struct " }) {
+				if (name.starts_with(prefix)) {
+					name.erase(0, std::strlen(prefix));
+					break;
+				}
+			}
+			return name;
+		}
+	} // namespace
+
+	const char* type_name(const std::type_info& type) {
+		// Function-local so it works from static initializers (component registration)
+		static std::mutex s_mutex;
+		static std::unordered_map<std::type_index, std::string> s_names;
+
+		std::lock_guard lock(s_mutex);
+		auto [it, inserted] = s_names.try_emplace(std::type_index(type));
+		if (inserted) it->second = readable(type.name());
+		return it->second.c_str();
+	}
+
+} // namespace me
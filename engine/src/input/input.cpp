@@ -1,6 +1,6 @@
 #include "mini-engine-raylib/input/input.hpp"
-
-#include <raylib.h>
+#include "input_internal.hpp"
+#include "../platform/platform.hpp"
 
 #include <unordered_map>
 #include <vector>
@@ -23,64 +23,23 @@ namespace me::input {
 		std::unordered_map<std::string, float> s_axis_deadzone;
 		std::unordered_map<std::string, std::pair<float, float>> s_axis_clamp;
 
-		static int to_raylib_key(Key k) {
-			switch (k) {
-			case Key::Escape: return KEY_ESCAPE;
-			case Key::Enter: return KEY_ENTER;
-			case Key::Space: return KEY_SPACE;
-			case Key::Tab: return KEY_TAB;
-			case Key::Backspace: return KEY_BACKSPACE;
-			case Key::Left: return KEY_LEFT;
-			case Key::Right: return KEY_RIGHT;
-			case Key::Up: return KEY_UP;
-			case Key::Down: return KEY_DOWN;
-			case Key::F1: return KEY_F1; case Key::F2: return KEY_F2;
-			case Key::F3: return KEY_F3; case Key::F4: return KEY_F4;
-			case Key::F5: return KEY_F5; case Key::F6: return KEY_F6;
-			case Key::F7: return KEY_F7; case Key::F8: return KEY_F8;
-			case Key::F9: return KEY_F9; case Key::F10: return KEY_F10;
-			case Key::F11: return KEY_F11; case Key::F12: return KEY_F12;
-			case Key::D0: return KEY_ZERO;  case Key::D1: return KEY_ONE;
-			case Key::D2: return KEY_TWO;   case Key::D3: return KEY_THREE;
-			case Key::D4: return KEY_FOUR;  case Key::D5: return KEY_FIVE;
-			case Key::D6: return KEY_SIX;   case Key::D7: return KEY_SEVEN;
-			case Key::D8: return KEY_EIGHT; case Key::D9: return KEY_NINE;
-			case Key::A: return KEY_A; case Key::B: return KEY_B; case Key::C: return KEY_C;
-			case Key::D: return KEY_D; case Key::E: return KEY_E; case Key::F: return KEY_F;
-			case Key::G: return KEY_G; case Key::H: return KEY_H; case Key::I: return KEY_I;
-			case Key::J: return KEY_J; case Key::K: return KEY_K; case Key::L: return KEY_L;
-			case Key::M: return KEY_M; case Key::N: return KEY_N; case Key::O: return KEY_O;
-			case Key::P: return KEY_P; case Key::Q: return KEY_Q; case Key::R: return KEY_R;
-			case Key::S: return KEY_S; case Key::T: return KEY_T; case Key::U: return KEY_U;
-			case Key::V: return KEY_V; case Key::W: return KEY_W; case Key::X: return KEY_X;
-			case Key::Y: return KEY_Y; case Key::Z: return KEY_Z;
-			}
-			return KEY_NULL;
-		}
+		FrameInput s_frame;
 
-		static int to_raylib_mouse_button(MouseButton b) {
-			switch (b) {
-			case MouseButton::Left:   return MOUSE_BUTTON_LEFT;
-			case MouseButton::Right:  return MOUSE_BUTTON_RIGHT;
-			case MouseButton::Middle: return MOUSE_BUTTON_MIDDLE;
-			case MouseButton::Button4:return MOUSE_BUTTON_SIDE;
-			case MouseButton::Button5:return MOUSE_BUTTON_EXTRA;
-			}
-			return MOUSE_BUTTON_LEFT;
-		}
+		inline std::uint64_t key_bit(Key k) { return std::uint64_t{ 1 } << static_cast<int>(k); }
+		inline std::uint8_t button_bit(MouseButton b) { return static_cast<std::uint8_t>(1u << static_cast<int>(b)); }
 
 		static float sample_axis_raw(Axis a) {
 			switch (a) {
-			case Axis::MouseX:    return GetMouseDelta().x;
-			case Axis::MouseY:    return GetMouseDelta().y;
-			case Axis::MouseWheel:return GetMouseWheelMove();
+			case Axis::MouseX:    return s_frame.mouse_delta.x;
+			case Axis::MouseY:    return s_frame.mouse_delta.y;
+			case Axis::MouseWheel:return s_frame.mouse_wheel;
 			}
 			return 0.0f;
 		}
 
 		static float sample_digital(Key neg, Key pos) {
-			const bool n = IsKeyDown(to_raylib_key(neg));
-			const bool p = IsKeyDown(to_raylib_key(pos));
+			const bool n = (s_frame.keys_down & key_bit(neg)) != 0;
+			const bool p = (s_frame.keys_down & key_bit(pos)) != 0;
 			return (p ? 1.0f : 0.0f) - (n ? 1.0f : 0.0f);
 		}
 
@@ -89,7 +48,7 @@ namespace me::input {
 			auto it = s_action_key_bindings.find(action);
 			if (it == s_action_key_bindings.end()) return false;
 			for (Key k : it->second) {
-				if (pred(to_raylib_key(k))) return true;
+				if (pred(k)) return true;
 			}
 			return false;
 		}
@@ -99,7 +58,7 @@ namespace me::input {
 			auto it = s_action_mouse_bindings.find(action);
 			if (it == s_action_mouse_bindings.end()) return false;
 			for (MouseButton b : it->second) {
-				if (pred(to_raylib_mouse_button(b))) return true;
+				if (pred(b)) return true;
 			}
 			return false;
 		}
@@ -121,10 +80,37 @@ namespace me::input {
 		}
 	}
 
-	void poll() {}
+	FrameInput& internal_frame_input() {
+		return s_frame;
+	}
+
+	void poll() {
+		auto& backend = me::platform::get();
+		FrameInput frame;
+
+		for (int i = 0; i < k_key_count; ++i) {
+			const Key k = static_cast<Key>(i);
+			if (backend.key_down(k)) frame.keys_down |= key_bit(k);
+			if (backend.key_pressed(k)) frame.keys_pressed |= key_bit(k);
+			if (backend.key_released(k)) frame.keys_released |= key_bit(k);
+		}
+
+		for (int i = 0; i < k_mouse_button_count; ++i) {
+			const MouseButton b = static_cast<MouseButton>(i);
+			if (backend.mouse_down(b)) frame.mouse_down |= button_bit(b);
+			if (backend.mouse_pressed(b)) frame.mouse_pressed |= button_bit(b);
+			if (backend.mouse_released(b)) frame.mouse_released |= button_bit(b);
+		}
+
+		frame.mouse_position = backend.mouse_position();
+		frame.mouse_delta = backend.mouse_delta();
+		frame.mouse_wheel = backend.mouse_wheel();
+
+		s_frame = frame;
+	}
 
-	void lock_cursor() { DisableCursor(); }
-	void unlock_cursor() { EnableCursor(); }
+	void lock_cursor() { me::platform::get().set_cursor_locked(true); }
+	void unlock_cursor() { me::platform::get().set_cursor_locked(false); }
 
 	void bind_action(const std::string& action, Key key) {
 		auto& v = s_action_key_bindings[action];
@@ -160,15 +146,18 @@ namespace me::input {
 	}
 
 	bool action_down(const std::string& action) {
-		return any_key_bound(action, &IsKeyDown) || any_mouse_bound(action, &IsMouseButtonDown);
+		return any_key_bound(action, [](Key k) { return (s_frame.keys_down & key_bit(k)) != 0; })
+			|| any_mouse_bound(action, [](MouseButton b) { return (s_frame.mouse_down & button_bit(b)) != 0; });
 	}
 
 	bool action_pressed(const std::string& action) {
-		return any_key_bound(action, &IsKeyPressed) || any_mouse_bound(action, &IsMouseButtonPressed);
+		return any_key_bound(action, [](Key k) { return (s_frame.keys_pressed & key_bit(k)) != 0; })
+			|| any_mouse_bound(action, [](MouseButton b) { return (s_frame.mouse_pressed & button_bit(b)) != 0; });
 	}
 
 	bool action_released(const std::string& action) {
-		return any_key_bound(action, &IsKeyReleased) || any_mouse_bound(action, &IsMouseButtonReleased);
+		return any_key_bound(action, [](Key k) { return (s_frame.keys_released & key_bit(k)) != 0; })
+			|| any_mouse_bound(action, [](MouseButton b) { return (s_frame.mouse_released & button_bit(b)) != 0; });
 	}
 
 	std::vector<Key> get_key_bindings(const std::string& action) {
@@ -263,14 +252,14 @@ namespace me::input {
 	}
 
 	me::math::Vec2 mouse_position() {
-		return { GetMousePosition().x, GetMousePosition().y };
+		return s_frame.mouse_position;
 	}
 
 	me::math::Vec2 mouse_delta() {
-		return { GetMouseDelta().x, GetMouseDelta().y };
+		return s_frame.mouse_delta;
 	}
 
 	float mouse_wheel_delta() {
-		return GetMouseWheelMove();
+		return s_frame.mouse_wheel;
 	}
 }
\ No newline at end of file
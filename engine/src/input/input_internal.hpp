@@ -0,0 +1,33 @@
+#pragma once
+
+#include "mini-engine-raylib/input/input.hpp"
+
+#include <cstdint>
+
+namespace me::input {
+
+	constexpr int k_key_count = static_cast<int>(Key::Z) + 1;
+	constexpr int k_mouse_button_count = static_cast<int>(MouseButton::Button5) + 1;
+
+	static_assert(k_key_count <= 64, "FrameInput stores keys as 64-bit masks");
+
+	// Everything the input module reads from the platform in one frame.
+	// Captured once by poll(); every query during the frame reads from it.
+	struct FrameInput {
+		std::uint64_t keys_down = 0;
+		std::uint64_t keys_pressed = 0;
+		std::uint64_t keys_released = 0;
+
+		std::uint8_t mouse_down = 0;
+		std::uint8_t mouse_pressed = 0;
+		std::uint8_t mouse_released = 0;
+
+		me::math::Vec2 mouse_position{};
+		me::math::Vec2 mouse_delta{};
+		float mouse_wheel = 0.0f;
+	};
+
+	// Internal-only: the replay system records or overrides this right after poll()
+	FrameInput& internal_frame_input();
+
+} // namespace me::input
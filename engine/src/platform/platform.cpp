@@ -0,0 +1,37 @@
+#include "platform.hpp"
+
+namespace me::platform {
+
+	namespace {
+		std::unique_ptr<Backend> s_backend;
+		bool s_headless = true;
+	}
+
+	bool init(const AppConfig& config) {
+#if ME_HAS_RAYLIB
+		s_headless = config.headless;
+		s_backend = s_headless ? create_null_backend() : create_raylib_backend();
+#else
+		s_headless = true;
+		s_backend = create_null_backend();
+#endif
+
+		return s_backend->init(config);
+	}
+
+	void shutdown() {
+		if (s_backend) s_backend->shutdown();
+		s_backend.reset();
+	}
+
+	Backend& get() {
+		// Allow input/time queries before init (e.g. from static setup code)
+		if (!s_backend) s_backend = create_null_backend();
+		return *s_backend;
+	}
+
+	bool is_headless() {
+		return s_headless;
+	}
+
+} // namespace me::platform
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "mini-engine-raylib/core/application.hpp"
+#include "mini-engine-raylib/core/math.hpp"
+#include "mini-engine-raylib/input/input.hpp"
+
+#include <memory>
+
+namespace me::platform {
+
+	// Window, timing and raw input backend.
+	// The engine talks to this instead of calling raylib directly, so it can run without a display.
+	class Backend {
+	public:
+		virtual ~Backend() = default;
+
+		// ---- window ----
+		virtual bool init(const AppConfig& config) = 0;
+		virtual void shutdown() = 0;
+		virtual bool should_close() = 0;
+		virtual bool is_resized() = 0;
+		virtual int width() = 0;
+		virtual int height() = 0;
+		virtual void set_title(const char* title) = 0;
+
+		// ---- frame ----
+		virtual void begin_frame() = 0;
+		virtual void end_frame() = 0;
+		virtual float frame_time() = 0;  // Duration of the last frame in seconds
+		virtual double time() = 0;       // Seconds since init
+		virtual int fps() = 0;
+
+		// ---- raw input ----
+		virtual bool key_down(me::input::Key key) = 0;
+		virtual bool key_pressed(me::input::Key key) = 0;
+		virtual bool key_released(me::input::Key key) = 0;
+
+		virtual bool mouse_down(me::input::MouseButton button) = 0;
+		virtual bool mouse_pressed(me::input::MouseButton button) = 0;
+		virtual bool mouse_released(me::input::MouseButton button) = 0;
+
+		virtual me::math::Vec2 mouse_position() = 0;
+		virtual me::math::Vec2 mouse_delta() = 0;
+		virtual float mouse_wheel() = 0;
+
+		virtual void set_cursor_locked(bool locked) = 0;
+	};
+
+	// Picks the backend for this config (null when headless or built without raylib) and initializes it
+	bool init(const AppConfig& config);
+	void shutdown();
+
+	Backend& get();
+
+	// True when running on the null backend (no window, audio or GPU)
+	bool is_headless();
+
+	std::unique_ptr<Backend> create_null_backend();
+
+#if ME_HAS_RAYLIB
+	std::unique_ptr<Backend> create_raylib_backend();
+#endif
+
+} // namespace me::platform
@@ -0,0 +1,98 @@
+#include "platform.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace me::platform {
+
+	namespace {
+
+		using clock = std::chrono::steady_clock;
+
+		// No window, no input. Frames are paced by target_fps, or run as fast as possible.
+		// With a fixed tick rate and no target_fps, every frame advances exactly one tick
+		// so simulation-only runs are reproducible.
+		class NullBackend final : public Backend {
+		public:
+			bool init(const AppConfig& config) override {
+				m_width = config.width;
+				m_height = config.height;
+				m_frame_budget = config.target_fps > 0 ? 1.0 / config.target_fps : 0.0;
+				m_sim_step = (config.fixed_tick_rate > 0 && config.target_fps <= 0) ? 1.0 / config.fixed_tick_rate : 0.0;
+
+				m_frame_start = clock::now();
+				m_fps_window_start = m_frame_start;
+				return true;
+			}
+
+			void shutdown() override {}
+			bool should_close() override { return false; }
+			bool is_resized() override { return false; }
+			int width() override { return m_width; }
+			int height() override { return m_height; }
+			void set_title(const char*) override {}
+
+			void begin_frame() override {}
+
+			void end_frame() override {
+				if (m_frame_budget > 0.0) {
+					auto deadline = m_frame_start + std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(m_frame_budget));
+					std::this_thread::sleep_until(deadline);
+				}
+
+				const auto now = clock::now();
+				const double real_dt = std::chrono::duration<double>(now - m_frame_start).count();
+				m_frame_start = now;
+
+				m_frame_time = m_sim_step > 0.0 ? m_sim_step : real_dt;
+				m_time += m_frame_time;
+
+				++m_fps_frames;
+				const double window = std::chrono::duration<double>(now - m_fps_window_start).count();
+				if (window >= 1.0) {
+					m_fps = static_cast<int>(m_fps_frames / window);
+					m_fps_frames = 0;
+					m_fps_window_start = now;
+				}
+			}
+
+			float frame_time() override { return static_cast<float>(m_frame_time); }
+			double time() override { return m_time; }
+			int fps() override { return m_fps; }
+
+			bool key_down(me::input::Key) override { return false; }
+			bool key_pressed(me::input::Key) override { return false; }
+			bool key_released(me::input::Key) override { return false; }
+
+			bool mouse_down(me::input::MouseButton) override { return false; }
+			bool mouse_pressed(me::input::MouseButton) override { return false; }
+			bool mouse_released(me::input::MouseButton) override { return false; }
+
+			me::math::Vec2 mouse_position() override { return {}; }
+			me::math::Vec2 mouse_delta() override { return {}; }
+			float mouse_wheel() override { return 0.0f; }
+
+			void set_cursor_locked(bool) override {}
+
+		private:
+			int m_width = 0;
+			int m_height = 0;
+
+			double m_frame_budget = 0.0;
+			double m_sim_step = 0.0;
+			double m_frame_time = 0.0;
+			double m_time = 0.0;
+
+			clock::time_point m_frame_start{};
+			clock::time_point m_fps_window_start{};
+			int m_fps_frames = 0;
+			int m_fps = 0;
+		};
+
+	} // namespace
+
+	std::unique_ptr<Backend> create_null_backend() {
+		return std::make_unique<NullBackend>();
+	}
+
+} // namespace me::platform
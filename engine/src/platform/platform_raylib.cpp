@@ -0,0 +1,125 @@
+#include "platform.hpp"
+
+#include <raylib.h>
+
+namespace me::platform {
+
+	namespace {
+
+		using me::input::Key;
+		using me::input::MouseButton;
+
+		static int to_raylib_key(Key k) {
+			switch (k) {
+			case Key::Escape: return KEY_ESCAPE;
+			case Key::Enter: return KEY_ENTER;
+			case Key::Space: return KEY_SPACE;
+			case Key::Tab: return KEY_TAB;
+			case Key::Backspace: return KEY_BACKSPACE;
+			case Key::Left: return KEY_LEFT;
+			case Key::Right: return KEY_RIGHT;
+			case Key::Up: return KEY_UP;
+			case Key::Down: return KEY_DOWN;
+			case Key::F1: return KEY_F1; case Key::F2: return KEY_F2;
+			case Key::F3: return KEY_F3; case Key::F4: return KEY_F4;
+			case Key::F5: return KEY_F5; case Key::F6: return KEY_F6;
+			case Key::F7: return KEY_F7; case Key::F8: return KEY_F8;
+			case Key::F9: return KEY_F9; case Key::F10: return KEY_F10;
+			case Key::F11: return KEY_F11; case Key::F12: return KEY_F12;
+			case Key::D0: return KEY_ZERO;  case Key::D1: return KEY_ONE;
+			case Key::D2: return KEY_TWO;   case Key::D3: return KEY_THREE;
+			case Key::D4: return KEY_FOUR;  case Key::D5: return KEY_FIVE;
+			case Key::D6: return KEY_SIX;   case Key::D7: return KEY_SEVEN;
+			case Key::D8: return KEY_EIGHT; case Key::D9: return KEY_NINE;
+			case Key::A: return KEY_A; case Key::B: return KEY_B; case Key::C: return KEY_C;
+			case Key::D: return KEY_D; case Key::E: return KEY_E; case Key::F: return KEY_F;
+			case Key::G: return KEY_G; case Key::H: return KEY_H; case Key::I: return KEY_I;
+			case Key::J: return KEY_J; case Key::K: return KEY_K; case Key::L: return KEY_L;
+			case Key::M: return KEY_M; case Key::N: return KEY_N; case Key::O: return KEY_O;
+			case Key::P: return KEY_P; case Key::Q: return KEY_Q; case Key::R: return KEY_R;
+			case Key::S: return KEY_S; case Key::T: return KEY_T; case Key::U: return KEY_U;
+			case Key::V: return KEY_V; case Key::W: return KEY_W; case Key::X: return KEY_X;
+			case Key::Y: return KEY_Y; case Key::Z: return KEY_Z;
+			}
+			return KEY_NULL;
+		}
+
+		static int to_raylib_mouse_button(MouseButton b) {
+			switch (b) {
+			case MouseButton::Left:   return MOUSE_BUTTON_LEFT;
+			case MouseButton::Right:  return MOUSE_BUTTON_RIGHT;
+			case MouseButton::Middle: return MOUSE_BUTTON_MIDDLE;
+			case MouseButton::Button4:return MOUSE_BUTTON_SIDE;
+			case MouseButton::Button5:return MOUSE_BUTTON_EXTRA;
+			}
+			return MOUSE_BUTTON_LEFT;
+		}
+
+		class RaylibBackend final : public Backend {
+		public:
+			bool init(const AppConfig& config) override {
+				if (config.vsync) {
+					SetConfigFlags(FLAG_VSYNC_HINT);
+				}
+
+				InitWindow(config.width, config.height, config.title.c_str());
+				SetExitKey(0); // Disable default ESC to close
+
+				if (!config.vsync) {
+					if (config.target_fps > 0) SetTargetFPS(config.target_fps);
+					else SetTargetFPS(0);
+				}
+				return true;
+			}
+
+			void shutdown() override { CloseWindow(); }
+			bool should_close() override { return WindowShouldClose(); }
+			bool is_resized() override { return IsWindowResized(); }
+			int width() override { return GetScreenWidth(); }
+			int height() override { return GetScreenHeight(); }
+			void set_title(const char* title) override { SetWindowTitle(title); }
+
+			void begin_frame() override {
+				BeginDrawing();
+				//ClearBackground({ 25, 25, 30, 255 });
+				ClearBackground({ 0, 0, 0, 0 });
+			}
+
+			void end_frame() override { EndDrawing(); }
+			float frame_time() override { return GetFrameTime(); }
+			double time() override { return GetTime(); }
+			int fps() override { return GetFPS(); }
+
+			bool key_down(Key key) override { return IsKeyDown(to_raylib_key(key)); }
+			bool key_pressed(Key key) override { return IsKeyPressed(to_raylib_key(key)); }
+			bool key_released(Key key) override { return IsKeyReleased(to_raylib_key(key)); }
+
+			bool mouse_down(MouseButton button) override { return IsMouseButtonDown(to_raylib_mouse_button(button)); }
+			bool mouse_pressed(MouseButton button) override { return IsMouseButtonPressed(to_raylib_mouse_button(button)); }
+			bool mouse_released(MouseButton button) override { return IsMouseButtonReleased(to_raylib_mouse_button(button)); }
+
+			me::math::Vec2 mouse_position() override {
+				::Vector2 p = GetMousePosition();
+				return { p.x, p.y };
+			}
+
+			me::math::Vec2 mouse_delta() override {
+				::Vector2 d = GetMouseDelta();
+				return { d.x, d.y };
+			}
+
+			float mouse_wheel() override { return GetMouseWheelMove(); }
+
+			void set_cursor_locked(bool locked) override {
+				if (locked) DisableCursor();
+				else EnableCursor();
+			}
+		};
+
+	} // namespace
+
+	std::unique_ptr<Backend> create_raylib_backend() {
+		return std::make_unique<RaylibBackend>();
+	}
+
+} // namespace me::platform
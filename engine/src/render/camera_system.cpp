@@ -1,5 +1,6 @@
 #include "mini-engine-raylib/render/camera_system.hpp"
 #include "mini-engine-raylib/ecs/components.hpp"
+#include "mini-engine-raylib/ecs/view.hpp"
 #include "mini-engine-raylib/core/engine.hpp"
 #include "mini-engine-raylib/input/input.hpp"
 #include "mini-engine-raylib/core/math.hpp"
@@ -13,28 +14,21 @@ namespace me::camera {
 
 	void update_free_fly(float dt) {
 		auto& reg = me::get_registry();
-		auto& cam_pool = reg.view<me::components::CameraComponent>();
 
 		const float mouse_sens = 0.5f;
 		const float move_speed = 10.0f;
 
-		// Iterate sparse set
-		for (size_t i = 0; i < cam_pool.size(); ++i) {
-			me::entity::entity_id e = cam_pool.entity_map[i];
-			auto& cam = cam_pool.components[i];
-
+		// Cameras with a transform (driven by the camera pool, the smaller one)
+		for (auto [e, cam, t] : me::view<me::components::CameraComponent, me::components::TransformComponent>(reg)) {
 			if (!cam.active) continue;
 
-			auto* t = reg.try_get_component<me::components::TransformComponent>(e);
-			if (!t) continue;
-
 			// --- 1. Rotation ---
-			t->rot_y -= me::input::axis_value("LookX") * mouse_sens;
-			t->rot_x -= me::input::axis_value("LookY") * mouse_sens;
-			t->rot_x = std::clamp(t->rot_x, -89.0f, 89.0f);
+			t.rot_y -= me::input::axis_value("LookX") * mouse_sens;
+			t.rot_x -= me::input::axis_value("LookY") * mouse_sens;
+			t.rot_x = std::clamp(t.rot_x, -89.0f, 89.0f);
 
-			float yaw_rad = t->rot_y * (me::math::pi / 180.0f);
-			float pitch_rad = t->rot_x * (me::math::pi / 180.0f);
+			float yaw_rad = t.rot_y * (me::math::pi / 180.0f);
+			float pitch_rad = t.rot_x * (me::math::pi / 180.0f);
 
 			// --- 2. Calculate Look Direction ---
 			float look_x = std::sin(yaw_rad) * std::cos(pitch_rad);
@@ -53,14 +47,14 @@ namespace me::camera {
 			float move_up = me::input::axis_value("MoveY");
 
 			// --- 5. Apply Movement ---
-			t->x += (fwd_x * move_forward + right_x * move_strafe) * move_speed * dt;
-			t->z += (fwd_z * move_forward + right_z * move_strafe) * move_speed * dt;
-			t->y += (move_up * move_speed * dt);
+			t.x += (fwd_x * move_forward + right_x * move_strafe) * move_speed * dt;
+			t.z += (fwd_z * move_forward + right_z * move_strafe) * move_speed * dt;
+			t.y += (move_up * move_speed * dt);
 
 			// --- 6. Update Target ---
-			cam.target_x = t->x + look_x;
-			cam.target_y = t->y + look_y;
-			cam.target_z = t->z + look_z;
+			cam.target_x = t.x + look_x;
+			cam.target_y = t.y + look_y;
+			cam.target_z = t.z + look_z;
 		}
 	}
 
@@ -0,0 +1,163 @@
+#include "frustum.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define ME_FRUSTUM_SSE 1
+#include <xmmintrin.h>
+#else
+#define ME_FRUSTUM_SSE 0
+#endif
+
+namespace me::render {
+
+	namespace {
+		struct V3 { float x, y, z; };
+
+		V3 sub(V3 a, V3 b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+		V3 cross(V3 a, V3 b) { return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x }; }
+		float dot(V3 a, V3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+		bool normalize(V3& v) {
+			const float len = std::sqrt(dot(v, v));
+			if (len < 1e-6f) return false;
+			v = { v.x / len, v.y / len, v.z / len };
+			return true;
+		}
+
+		// Row-major 4x4, column-vector convention (clip = P * V * p)
+		using Mat4 = float[4][4];
+
+		void multiply(const Mat4 a, const Mat4 b, Mat4 out) {
+			for (int r = 0; r < 4; ++r)
+				for (int c = 0; c < 4; ++c)
+					out[r][c] = a[r][0] * b[0][c] + a[r][1] * b[1][c] + a[r][2] * b[2][c] + a[r][3] * b[3][c];
+		}
+	} // namespace
+
+	bool internal_make_frustum(const CameraView3D& camera, float aspect, float near_plane, float far_plane, Frustum& out) {
+		const V3 eye{ camera.position[0], camera.position[1], camera.position[2] };
+		const V3 target{ camera.target[0], camera.target[1], camera.target[2] };
+		const V3 up{ camera.up[0], camera.up[1], camera.up[2] };
+
+		V3 f = sub(target, eye);
+		if (!normalize(f)) return false;
+		V3 s = cross(f, up);
+		if (!normalize(s)) return false;
+		const V3 u = cross(s, f);
+
+		const Mat4 view = {
+			{ s.x, s.y, s.z, -dot(s, eye) },
+			{ u.x, u.y, u.z, -dot(u, eye) },
+			{ -f.x, -f.y, -f.z, dot(f, eye) },
+			{ 0.0f, 0.0f, 0.0f, 1.0f },
+		};
+
+		// Same projections BeginMode3D sets up (orthographic uses fovy as the view height)
+		Mat4 proj = {};
+		const float n = near_plane, fa = far_plane;
+		if (camera.projection == 0) {
+			const float t = std::tan(camera.fovy * 0.5f * 3.14159265358979323846f / 180.0f);
+			proj[0][0] = 1.0f / (aspect * t);
+			proj[1][1] = 1.0f / t;
+			proj[2][2] = -(fa + n) / (fa - n);
+			proj[2][3] = -2.0f * fa * n / (fa - n);
+			proj[3][2] = -1.0f;
+		} else {
+			const float top = camera.fovy * 0.5f;
+			proj[0][0] = 1.0f / (top * aspect);
+			proj[1][1] = 1.0f / top;
+			proj[2][2] = -2.0f / (fa - n);
+			proj[2][3] = -(fa + n) / (fa - n);
+			proj[3][3] = 1.0f;
+		}
+
+		Mat4 clip;
+		multiply(proj, view, clip);
+
+		// Gribb/Hartmann: left, right, bottom, top, near, far
+		for (int i = 0; i < 6; ++i) {
+			const int row = i / 2;
+			const float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+			float* p = out.planes[i];
+			for (int c = 0; c < 4; ++c) p[c] = clip[3][c] + sign * clip[row][c];
+
+			const float len = std::sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+			if (len < 1e-6f) return false;
+			for (int c = 0; c < 4; ++c) p[c] /= len;
+		}
+		return true;
+	}
+
+	float internal_bounding_radius(me::components::MeshRendererComponent::Type type, const float model[16]) {
+		// Unit primitives as drawn by render_world: 2x2x2 cube, r=1 sphere, 2x2 plane
+		constexpr float k_cube = 1.7320508f;   // sqrt(3)
+		constexpr float k_sphere = 1.0f;
+		constexpr float k_plane = 1.4142136f;  // sqrt(2)
+
+		// Longest basis vector = largest scale, whatever the rotation
+		const float len0 = model[0] * model[0] + model[1] * model[1] + model[2] * model[2];
+		const float len1 = model[4] * model[4] + model[5] * model[5] + model[6] * model[6];
+		const float len2 = model[8] * model[8] + model[9] * model[9] + model[10] * model[10];
+		const float scale = std::sqrt(std::max({ len0, len1, len2 }));
+		switch (type) {
+			case me::components::MeshRendererComponent::Cube: return k_cube * scale;
+			case me::components::MeshRendererComponent::Sphere: return k_sphere * scale;
+			case me::components::MeshRendererComponent::Plane: return k_plane * scale;
+		}
+		return k_cube * scale;
+	}
+
+	std::size_t internal_cull_spheres(const Frustum& frustum, const float* x, const float* y, const float* z, const float* radius,
+		std::size_t count, std::uint8_t* visible) {
+		std::size_t visible_count = 0;
+		std::size_t i = 0;
+
+#if ME_FRUSTUM_SSE
+		__m128 nx[6], ny[6], nz[6], nd[6];
+		for (int p = 0; p < 6; ++p) {
+			nx[p] = _mm_set1_ps(frustum.planes[p][0]);
+			ny[p] = _mm_set1_ps(frustum.planes[p][1]);
+			nz[p] = _mm_set1_ps(frustum.planes[p][2]);
+			nd[p] = _mm_set1_ps(frustum.planes[p][3]);
+		}
+
+		for (; i + 4 <= count; i += 4) {
+			const __m128 px = _mm_loadu_ps(x + i);
+			const __m128 py = _mm_loadu_ps(y + i);
+			const __m128 pz = _mm_loadu_ps(z + i);
+			const __m128 neg_r = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + i));
+
+			// Inside unless fully behind one plane: dist >= -r for all six
+			__m128 inside = _mm_cmpeq_ps(px, px); // All ones (positions are never NaN)
+			for (int p = 0; p < 6; ++p) {
+				__m128 dist = _mm_add_ps(_mm_mul_ps(nx[p], px), nd[p]);
+				dist = _mm_add_ps(dist, _mm_mul_ps(ny[p], py));
+				dist = _mm_add_ps(dist, _mm_mul_ps(nz[p], pz));
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, neg_r));
+			}
+
+			const int mask = _mm_movemask_ps(inside);
+			for (int k = 0; k < 4; ++k) {
+				const std::uint8_t v = static_cast<std::uint8_t>((mask >> k) & 1);
+				visible[i + k] = v;
+				visible_count += v;
+			}
+		}
+#endif
+
+		for (; i < count; ++i) {
+			bool inside = true;
+			for (int p = 0; p < 6 && inside; ++p) {
+				const float* pl = frustum.planes[p];
+				inside = pl[0] * x[i] + pl[1] * y[i] + pl[2] * z[i] + pl[3] >= -radius[i];
+			}
+			visible[i] = inside ? 1 : 0;
+			visible_count += inside ? 1 : 0;
+		}
+
+		return visible_count;
+	}
+
+} // namespace me::render
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "render_internal.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace me::render {
+
+	// Six inward-facing planes (nx, ny, nz, d): a point p is inside when dot(n, p) + d >= 0
+	struct Frustum {
+		float planes[6][4];
+	};
+
+	// Builds the frustum render_world's camera sees. Returns false for a degenerate camera (up parallel to view dir).
+	bool internal_make_frustum(const CameraView3D& camera, float aspect, float near_plane, float far_plane, Frustum& out);
+
+	// Bounding sphere radius of a unit primitive under a world matrix (centered on its translation)
+	float internal_bounding_radius(me::components::MeshRendererComponent::Type type, const float model[16]);
+
+	// Tests `count` spheres given as SoA arrays; writes 1 (visible) or 0 (culled) per sphere.
+	// Returns the number of visible spheres. SSE over batches of 4 when available.
+	std::size_t internal_cull_spheres(const Frustum& frustum, const float* x, const float* y, const float* z, const float* radius,
+		std::size_t count, std::uint8_t* visible);
+
+} // namespace me::render
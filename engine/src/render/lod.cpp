@@ -0,0 +1,37 @@
+#include "lod.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace me::render {
+
+	float internal_pixels_per_unit(const CameraView3D& camera, float screen_height) {
+		if (screen_height <= 0.0f || camera.fovy <= 0.0f) return 0.0f;
+
+		// Orthographic: fovy is the view height in world units (raylib's convention)
+		if (camera.projection != 0) return screen_height / camera.fovy;
+
+		constexpr float k_deg2rad = 3.14159265358979323846f / 180.0f;
+		return screen_height / (2.0f * std::tan(camera.fovy * 0.5f * k_deg2rad));
+	}
+
+	float internal_projected_size(const CameraView3D& camera, float pixels_per_unit, float radius, float distance) {
+		const float diameter = 2.0f * radius * pixels_per_unit;
+		if (camera.projection != 0) return diameter;
+
+		// Camera inside the sphere: fills the screen
+		if (distance <= radius) return std::numeric_limits<float>::max();
+		return diameter / distance;
+	}
+
+	std::uint8_t internal_select_lod(float pixels, std::uint8_t previous) {
+		std::uint8_t level = 0;
+		for (int k = 0; k < k_lod_levels - 1; ++k) {
+			// Currently finer than this boundary: must shrink below the lower edge to cross it, and vice versa
+			const float edge = previous <= k ? k_lod_thresholds[k] * (1.0f - k_lod_hysteresis) : k_lod_thresholds[k] * (1.0f + k_lod_hysteresis);
+			if (pixels < edge) level = static_cast<std::uint8_t>(k + 1);
+		}
+		return level;
+	}
+
+} // namespace me::render
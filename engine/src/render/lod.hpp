@@ -0,0 +1,28 @@
+#pragma once
+
+#include "render_internal.hpp"
+
+#include <cstdint>
+
+namespace me::render {
+
+	// Sphere detail per LOD level (rings, slices). Level 0 is what render_world always drew.
+	constexpr int k_lod_levels = 3;
+	constexpr int k_sphere_lod[k_lod_levels][2] = { { 16, 16 }, { 10, 10 }, { 6, 6 } };
+
+	// Projected diameter in pixels where a sphere drops to the next level
+	constexpr float k_lod_thresholds[k_lod_levels - 1] = { 96.0f, 32.0f };
+
+	// Fraction a size must move past a threshold before the level changes back (avoids popping)
+	constexpr float k_lod_hysteresis = 0.15f;
+
+	// Pixels per world unit at distance 1 (perspective) or everywhere (orthographic). 0 if unknown.
+	float internal_pixels_per_unit(const CameraView3D& camera, float screen_height);
+
+	// Diameter in pixels of a bounding sphere `distance` away from the camera
+	float internal_projected_size(const CameraView3D& camera, float pixels_per_unit, float radius, float distance);
+
+	// Level for a projected size, staying at `previous` while the size is within the hysteresis band
+	std::uint8_t internal_select_lod(float pixels, std::uint8_t previous);
+
+} // namespace me::render
@@ -0,0 +1,205 @@
+#include "mesh_instancing.hpp"
+#include "lod.hpp"
+
+#include "mini-engine-raylib/core/frame_arena.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+
+#include <raylib.h>
+#include <raymath.h>
+#include <rlgl.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+namespace me::render {
+
+	namespace {
+		// Per-instance vertex data, uploaded as-is
+		struct InstanceData {
+			float model[16];
+			unsigned char color[4];
+		};
+
+		// Above raylib's default attribute locations (0..7)
+		constexpr int k_loc_transform = 8;   // mat4 takes 8..11
+		constexpr int k_loc_color = 12;
+
+		constexpr const char* k_vertex_shader = R"(
+layout(location = 0) in vec3 vertexPosition;
+layout(location = 8) in mat4 instanceTransform;
+layout(location = 12) in vec4 instanceColor;
+
+uniform mat4 mvp;
+
+out vec4 fragColor;
+
+void main() {
+	fragColor = instanceColor;
+	gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0);
+}
+)";
+
+		constexpr const char* k_fragment_shader = R"(
+in vec4 fragColor;
+out vec4 finalColor;
+
+void main() {
+	finalColor = fragColor;
+}
+)";
+
+		constexpr int k_type_count = 3; // MeshRendererComponent::Type
+
+		enum class State { Uninitialized, Ready, Unsupported };
+
+		State s_state = State::Uninitialized;
+		Shader s_shader{};
+		int s_mvp_loc = -1;
+		Mesh s_meshes[k_type_count]{};         // Cube and plane; spheres are in s_spheres
+		Mesh s_spheres[k_lod_levels]{};        // One per LOD level
+
+		// One streaming buffer holding every instance of the frame, in packet order
+		unsigned int s_vbo = 0;
+		std::size_t s_capacity = 0; // Bytes
+
+		bool init() {
+			const int gl = rlGetVersion();
+			std::string header;
+			if (gl == RL_OPENGL_33 || gl == RL_OPENGL_43) header = "#version 330\n";
+			else if (gl == RL_OPENGL_ES_30) header = "#version 300 es\nprecision mediump float;\n";
+			else return false;
+
+			const std::string vs = header + k_vertex_shader;
+			const std::string fs = header + k_fragment_shader;
+			s_shader = LoadShaderFromMemory(vs.c_str(), fs.c_str());
+
+			// raylib hands back its default shader when compilation fails
+			if (s_shader.id == 0 || s_shader.id == rlGetShaderIdDefault()) {
+				TraceLog(LOG_WARNING, "RENDER: Instancing shader failed to compile, using immediate mode");
+				return false;
+			}
+			s_mvp_loc = GetShaderLocation(s_shader, "mvp");
+
+			// Same dimensions as DrawCube(2,2,2) / DrawSphereEx(r=1, rings x slices) / DrawPlane(2x2)
+			s_meshes[me::components::MeshRendererComponent::Cube] = GenMeshCube(2.0f, 2.0f, 2.0f);
+			s_meshes[me::components::MeshRendererComponent::Plane] = GenMeshPlane(2.0f, 2.0f, 1, 1);
+			for (int level = 0; level < k_lod_levels; ++level)
+				s_spheres[level] = GenMeshSphere(1.0f, k_sphere_lod[level][0], k_sphere_lod[level][1]);
+			return true;
+		}
+
+		const Mesh& mesh_for(const MeshDraw& draw) {
+			if (draw.type == me::components::MeshRendererComponent::Sphere) return s_spheres[draw.lod];
+			return s_meshes[draw.type];
+		}
+
+		void upload(const InstanceData* data, std::size_t count) {
+			const std::size_t bytes = count * sizeof(InstanceData);
+
+			if (bytes > s_capacity) {
+				if (s_vbo != 0) rlUnloadVertexBuffer(s_vbo);
+				s_capacity = std::max(bytes, s_capacity + s_capacity / 2);
+				s_vbo = rlLoadVertexBuffer(nullptr, static_cast<int>(s_capacity), true);
+			}
+
+			rlUpdateVertexBuffer(s_vbo, data, static_cast<int>(bytes), 0);
+		}
+
+		// Draws instances [first, first + count) of the stream
+		void draw_run(const Mesh& mesh, std::size_t first, std::size_t count, bool wireframe) {
+			rlEnableVertexArray(mesh.vaoId);
+
+			// Instance attributes point into the stream at this run (VAO state, so set every draw)
+			const int base = static_cast<int>(first * sizeof(InstanceData));
+			rlEnableVertexBuffer(s_vbo);
+			for (int i = 0; i < 4; ++i) {
+				rlEnableVertexAttribute(k_loc_transform + i);
+				rlSetVertexAttribute(k_loc_transform + i, 4, RL_FLOAT, false, sizeof(InstanceData), base + static_cast<int>(i * 4 * sizeof(float)));
+				rlSetVertexAttributeDivisor(k_loc_transform + i, 1);
+			}
+			rlEnableVertexAttribute(k_loc_color);
+			rlSetVertexAttribute(k_loc_color, 4, RL_UNSIGNED_BYTE, true, sizeof(InstanceData), base + static_cast<int>(offsetof(InstanceData, color)));
+			rlSetVertexAttributeDivisor(k_loc_color, 1);
+			rlDisableVertexBuffer();
+
+			if (wireframe) rlEnableWireMode();
+
+			if (mesh.indices != nullptr) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount * 3, nullptr, static_cast<int>(count));
+			else rlDrawVertexArrayInstanced(0, mesh.vertexCount, static_cast<int>(count));
+
+			if (wireframe) rlDisableWireMode();
+
+			rlDisableVertexArray();
+		}
+	} // namespace
+
+	bool internal_draw_meshes_instanced(const WorldFrame& frame) {
+		ME_PROFILE_SCOPE("render::draw_instanced");
+
+		if (s_state == State::Uninitialized)
+			s_state = init() ? State::Ready : State::Unsupported;
+		if (s_state != State::Ready) return false;
+
+		const auto& packets = frame.packets;
+		if (packets.empty()) return true;
+
+		// 1. Instance stream in submission order, so every run is a contiguous range
+		auto instances = me::frame_arena().allocate_array<InstanceData>(packets.size());
+		for (std::size_t i = 0; i < packets.size(); ++i) {
+			const MeshDraw& draw = frame.meshes[packets[i].index];
+			std::copy(std::begin(draw.model), std::end(draw.model), instances[i].model);
+			instances[i].color[0] = draw.color.r;
+			instances[i].color[1] = draw.color.g;
+			instances[i].color[2] = draw.color.b;
+			instances[i].color[3] = draw.color.a;
+		}
+
+		// 2. Flush raylib's immediate batch (grid etc.) so draw order is kept
+		rlDrawRenderBatchActive();
+		upload(instances.data(), instances.size());
+
+		const Matrix model_view = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+		const Matrix mvp = MatrixMultiply(model_view, rlGetMatrixProjection());
+
+		rlEnableShader(s_shader.id);
+		rlSetUniformMatrix(s_mvp_loc, mvp);
+
+		// 3. One draw call per run of equal batches (opaque: one per material, transparent: split by depth order)
+		std::size_t run_begin = 0;
+		int draw_calls = 0;
+		for (std::size_t i = 1; i <= packets.size(); ++i) {
+			if (i < packets.size() && packets[i].batch == packets[run_begin].batch) continue;
+
+			const MeshDraw& first = frame.meshes[packets[run_begin].index];
+			draw_run(mesh_for(first), run_begin, i - run_begin, first.wireframe);
+			++draw_calls;
+			run_begin = i;
+		}
+
+		rlDisableShader();
+
+		ME_PROFILE_COUNTER("render::mesh_draw_calls", draw_calls);
+		(void)draw_calls;
+		return true;
+	}
+
+	void internal_release_instancing() {
+		if (s_vbo != 0) rlUnloadVertexBuffer(s_vbo);
+		s_vbo = 0;
+		s_capacity = 0;
+
+		if (s_state == State::Ready) {
+			for (Mesh& mesh : s_meshes) if (mesh.vaoId != 0) UnloadMesh(mesh);
+			for (Mesh& mesh : s_spheres) UnloadMesh(mesh);
+			UnloadShader(s_shader);
+		}
+
+		for (Mesh& mesh : s_meshes) mesh = {};
+		for (Mesh& mesh : s_spheres) mesh = {};
+		s_shader = {};
+		s_mvp_loc = -1;
+		s_state = State::Uninitialized;
+	}
+
+} // namespace me::render
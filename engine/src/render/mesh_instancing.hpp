@@ -0,0 +1,16 @@
+#pragma once
+
+#include "render_internal.hpp"
+
+namespace me::render {
+
+	// Internal-only (raylib builds): uploads the frame's sorted packets as one instance stream and draws
+	// each run of packets sharing a batch (layer, pass, type + wireframe) with one instanced call.
+	// Must be called between BeginMode3D/EndMode3D. Returns false if the GL context can't do instancing
+	// (GL 1.1/2.1, ES 2.0) so the caller can fall back to immediate mode.
+	bool internal_draw_meshes_instanced(const WorldFrame& frame);
+
+	// Frees the cached meshes, shader and instance buffers
+	void internal_release_instancing();
+
+} // namespace me::render
@@ -0,0 +1,244 @@
+#include "render_internal.hpp"
+#include "frustum.hpp"
+#include "lod.hpp"
+#include "../ecs/transform_internal.hpp"
+
+#include "mini-engine-raylib/core/frame_arena.hpp"
+#include "mini-engine-raylib/core/jobs.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+#include "mini-engine-raylib/ecs/view.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+namespace me::render {
+
+	namespace {
+		// Entities per extraction job
+		constexpr std::size_t k_extract_grain = 4096;
+
+		constexpr std::uint64_t k_dropped = std::numeric_limits<std::uint64_t>::max();
+
+		constexpr float k_rad2deg = 180.0f / 3.14159265358979323846f;
+
+		WorldFrame s_world[2];
+		SpriteFrame s_sprites[2];
+		int s_world_index = 0;
+		int s_sprite_index = 0;
+
+		std::vector<DrawPacket> s_scratch;
+
+		// Last LOD level per mesh pool slot, for hysteresis. s_lod_owner tells whether the slot still holds the same entity.
+		std::vector<std::uint8_t> s_lod;
+		std::vector<me::entity::entity_id> s_lod_owner;
+
+		template <typename T>
+		void grow(std::vector<T>& v, std::size_t n) {
+			if (v.size() < n) v.resize(n);
+		}
+
+		// Drops the packets extraction marked with k_dropped, then sorts the rest
+		void finish_packets(std::vector<DrawPacket>& packets, std::size_t n) {
+			std::size_t count = 0;
+			for (std::size_t i = 0; i < n; ++i)
+				if (packets[i].key != k_dropped) packets[count++] = packets[i];
+			packets.resize(count);
+
+			ME_PROFILE_SCOPE("render::sort");
+			grow(s_scratch, count);
+			radix_sort(packets, s_scratch);
+		}
+	} // namespace
+
+	const WorldFrame& internal_build_world(Registry& reg, const ViewParams& view) {
+		ME_PROFILE_SCOPE("render::build_world");
+
+		s_world_index ^= 1;
+		WorldFrame& frame = s_world[s_world_index];
+		frame.camera = {};
+		frame.culled = 0;
+		frame.too_small = 0;
+
+		for (auto [e, cam, t] : me::view<me::components::CameraComponent, me::components::TransformComponent>(reg)) {
+			if (cam.active) {
+				frame.camera = { { t.x, t.y, t.z }, { cam.target_x, cam.target_y, cam.target_z }, { cam.up_x, cam.up_y, cam.up_z }, cam.fov, cam.projection };
+				break;
+			}
+		}
+
+		// Meshes joined with their transforms; pools are created here, workers only read them
+		const auto& meshes = me::group<me::components::MeshRendererComponent, me::components::TransformComponent>(reg);
+
+		// Matrices from the engine's per-frame transform update (updated here when called outside the loop)
+		me::transform::internal_refresh(reg);
+		const me::transform::Matrix* world = me::transform::internal_world_matrices();
+
+		const size_t n = meshes.size();
+		grow(frame.meshes, n);
+		frame.packets.resize(n);
+
+		Frustum frustum;
+		const bool cull = n > 0 && view.aspect > 0.0f && internal_make_frustum(frame.camera, view.aspect, view.near_plane, view.far_plane, frustum);
+
+		// Bounding spheres as SoA so the test runs 4 entities per instruction
+		auto& arena = me::frame_arena();
+		auto matrices = arena.allocate_array<const float*>(n);
+		auto xs = arena.allocate_array<float>(cull ? n : 0);
+		auto ys = arena.allocate_array<float>(cull ? n : 0);
+		auto zs = arena.allocate_array<float>(cull ? n : 0);
+		auto rs = arena.allocate_array<float>(cull ? n : 0);
+		auto visible = arena.allocate_array<std::uint8_t>(n);
+
+		// Screen-size LOD: only with a known viewport
+		const float pixels_per_unit = internal_pixels_per_unit(frame.camera, view.screen_height);
+		if (pixels_per_unit > 0.0f) {
+			const size_t slots = reg.view<me::components::MeshRendererComponent>().size();
+			grow(s_lod, slots);
+			grow(s_lod_owner, slots);
+		}
+
+		const float eye[3] = { frame.camera.position[0], frame.camera.position[1], frame.camera.position[2] };
+		std::atomic<size_t> culled_total{ 0 };
+		std::atomic<size_t> small_total{ 0 };
+
+		me::jobs::parallel_for_chunks(0, n, k_extract_grain, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				const float* m = world[meshes.slot<me::components::TransformComponent>(i)].m;
+				matrices[i] = m;
+				visible[i] = 1;
+
+				if (cull) {
+					xs[i] = m[12];
+					ys[i] = m[13];
+					zs[i] = m[14];
+					rs[i] = internal_bounding_radius(meshes.get<me::components::MeshRendererComponent>(i).type, m);
+				}
+			}
+
+			size_t culled = 0;
+			if (cull) {
+				const size_t tested = end - begin;
+				culled = tested - internal_cull_spheres(frustum, &xs[begin], &ys[begin], &zs[begin], &rs[begin], tested, &visible[begin]);
+			}
+			culled_total.fetch_add(culled, std::memory_order_relaxed);
+
+			size_t small = 0;
+			for (size_t i = begin; i < end; ++i) {
+				DrawPacket& packet = frame.packets[i];
+				if (!visible[i]) {
+					packet.key = k_dropped;
+					continue;
+				}
+
+				const float* m = matrices[i];
+				const auto& mesh = meshes.get<me::components::MeshRendererComponent>(i);
+				const float dx = m[12] - eye[0], dy = m[13] - eye[1], dz = m[14] - eye[2];
+				const float distance_sq = dx * dx + dy * dy + dz * dz;
+
+				std::uint8_t lod = 0;
+				const bool sphere_lod = mesh.lod && mesh.type == me::components::MeshRendererComponent::Sphere;
+				if (pixels_per_unit > 0.0f && (sphere_lod || mesh.min_screen_size > 0.0f)) {
+					const float radius = cull ? rs[i] : internal_bounding_radius(mesh.type, m);
+					const float pixels = internal_projected_size(frame.camera, pixels_per_unit, radius, std::sqrt(distance_sq));
+					if (pixels < mesh.min_screen_size) {
+						packet.key = k_dropped;
+						++small;
+						continue;
+					}
+
+					if (sphere_lod) {
+						const me::entity::entity_id e = meshes.entity(i);
+						const size_t slot = meshes.slot<me::components::MeshRendererComponent>(i);
+						const std::uint8_t previous = s_lod_owner[slot] == e ? s_lod[slot] : 0;
+						lod = internal_select_lod(pixels, previous);
+						s_lod[slot] = lod;
+						s_lod_owner[slot] = e;
+					}
+				}
+
+				MeshDraw& draw = frame.meshes[i];
+				std::copy(m, m + 16, draw.model);
+				draw.color = mesh.color;
+				draw.type = mesh.type;
+				draw.wireframe = mesh.wireframe;
+				draw.lod = lod;
+
+				// Every (type, level) is its own mesh, so levels batch separately
+				const Pass pass = mesh.color.a < 255 ? Pass::Transparent : Pass::Opaque;
+				const std::uint32_t material = (static_cast<std::uint32_t>(mesh.type) * k_lod_levels + lod) * 2 + (mesh.wireframe ? 1 : 0);
+
+				packet.key = make_sort_key(mesh.layer, pass, material, distance_sq);
+				packet.batch = make_batch(mesh.layer, pass, material);
+				packet.index = static_cast<std::uint32_t>(i);
+			}
+			small_total.fetch_add(small, std::memory_order_relaxed);
+		});
+
+		finish_packets(frame.packets, n);
+		frame.culled = culled_total.load(std::memory_order_relaxed);
+		frame.too_small = small_total.load(std::memory_order_relaxed);
+
+		ME_PROFILE_COUNTER("render::visible", frame.packets.size());
+		ME_PROFILE_COUNTER("render::culled", frame.culled);
+		ME_PROFILE_COUNTER("render::too_small", frame.too_small);
+		return frame;
+	}
+
+	const SpriteFrame& internal_build_sprites(Registry& reg) {
+		ME_PROFILE_SCOPE("render::build_sprites");
+
+		s_sprite_index ^= 1;
+		SpriteFrame& frame = s_sprites[s_sprite_index];
+		frame.camera = {};
+
+		for (auto [e, cam, t] : me::view<me::components::Camera2DComponent, me::components::TransformComponent>(reg)) {
+			if (cam.active) {
+				frame.camera = { { t.x, t.y }, { cam.offset_x, cam.offset_y }, cam.rotation, cam.zoom }; // Camera follows Transform's X/Y
+				break;
+			}
+		}
+
+		const auto& sprites = me::group<me::components::SpriteComponent, me::components::TransformComponent>(reg);
+
+		// Parented sprites take their position, rotation and scale from the world matrix
+		me::transform::internal_refresh(reg);
+		const me::transform::Matrix* world = me::transform::internal_world_matrices();
+		const std::uint8_t* parented = me::transform::internal_parented();
+
+		const size_t n = sprites.size();
+		grow(frame.sprites, n);
+		frame.packets.resize(n);
+
+		me::jobs::parallel_for_chunks(0, n, k_extract_grain, [&](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				DrawPacket& packet = frame.packets[i];
+
+				const auto& sprite = sprites.get<me::components::SpriteComponent>(i);
+				const auto& t = sprites.get<me::components::TransformComponent>(i);
+				SpriteDraw& draw = frame.sprites[i];
+				float z = t.z;
+
+				const std::size_t slot = sprites.slot<me::components::TransformComponent>(i);
+				if (parented[slot]) {
+					const float* m = world[slot].m;
+					draw = { m[12], m[13], std::sqrt(m[0] * m[0] + m[1] * m[1]), std::sqrt(m[4] * m[4] + m[5] * m[5]),
+						std::atan2(m[1], m[0]) * k_rad2deg, sprite.texture, sprite.uv, sprite.tint };
+					z = m[14];
+				} else {
+					draw = { t.x, t.y, t.sx, t.sy, t.rot_z, sprite.texture, sprite.uv, sprite.tint };
+				}
+
+				// Painter's order on z, then grouped by texture
+				packet.key = make_sort_key(sprite.layer, Pass::Sprite, sprite.texture.handle, z);
+				packet.batch = make_batch(sprite.layer, Pass::Sprite, sprite.texture.handle);
+				packet.index = static_cast<std::uint32_t>(i);
+			}
+		});
+
+		finish_packets(frame.packets, n);
+		return frame;
+	}
+
+} // namespace me::render
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "mini-engine-raylib/ecs/components.hpp"
+#include "render_queue.hpp"
+
+#include <mini-ecs/registry.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace me::render {
+
+	struct CameraView3D {
+		float position[3] = { 10.0f, 10.0f, 10.0f };
+		float target[3] = { 0.0f, 0.0f, 0.0f };
+		float up[3] = { 0.0f, 1.0f, 0.0f };
+		float fovy = 45.0f;
+		int projection = 0;
+	};
+
+	struct CameraView2D {
+		float target[2] = { 0.0f, 0.0f };
+		float offset[2] = { 0.0f, 0.0f };
+		float rotation = 0.0f;
+		float zoom = 1.0f;
+	};
+
+	struct MeshDraw {
+		float model[16];             // Column-major, the transform's cached world matrix
+		me::Color color;
+		me::components::MeshRendererComponent::Type type;
+		bool wireframe;
+		std::uint8_t lod;            // Detail level, 0 = full (see lod.hpp)
+	};
+
+	struct SpriteDraw {
+		float x, y;
+		float sx, sy;
+		float rotation;              // Degrees
+		me::assets::TextureId texture;
+		me::assets::UvRect uv;
+		me::Color tint;
+	};
+
+	// Extraction output for render_world. Packets are sorted; packet.index points into `meshes`.
+	// Double-buffered: the previous frame's WorldFrame stays intact while the next one is built.
+	struct WorldFrame {
+		CameraView3D camera;
+		std::vector<MeshDraw> meshes;       // One per mesh/transform pair, only entries referenced by packets are valid
+		std::vector<DrawPacket> packets;    // Survivors of frustum culling, in submission order
+		std::size_t culled = 0;
+		std::size_t too_small = 0;          // Dropped by MeshRendererComponent::min_screen_size
+	};
+
+	// Extraction output for render_2d, same layout as WorldFrame
+	struct SpriteFrame {
+		CameraView2D camera;
+		std::vector<SpriteDraw> sprites;
+		std::vector<DrawPacket> packets;
+	};
+
+	// Viewport used for frustum culling and LOD. aspect <= 0 disables culling, screen_height <= 0 disables LOD.
+	struct ViewParams {
+		float aspect = 0.0f;
+		float screen_height = 0.0f;  // Pixels
+		float near_plane = 0.01f;    // raylib's RL_CULL_DISTANCE_NEAR/FAR
+		float far_plane = 1000.0f;
+	};
+
+	// Internal-only: extraction phases of render_world / render_2d. Walk the registry in parallel chunks
+	// on me::jobs and produce sorted packets. Don't touch the GPU, so they also run headless (benchmarks).
+	// The returned frame stays valid until the call after next.
+	const WorldFrame& internal_build_world(Registry& reg, const ViewParams& view = {});
+	const SpriteFrame& internal_build_sprites(Registry& reg);
+
+	// Internal-only: frees cached GPU meshes/buffers. Called by the engine before the window closes.
+	void internal_shutdown();
+
+} // namespace me::render
@@ -0,0 +1,69 @@
+#include "render_queue.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace me::render {
+
+	namespace {
+		// Maps a float to a uint32 with the same ordering (negatives included)
+		std::uint32_t sortable_bits(float value) {
+			const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+			return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+		}
+	} // namespace
+
+	std::uint64_t make_sort_key(std::uint8_t layer, Pass pass, std::uint32_t material, float depth) {
+		const std::uint64_t head = (static_cast<std::uint64_t>(layer) << 56) | (static_cast<std::uint64_t>(pass) << 52);
+		const std::uint64_t mat = material & k_material_mask;
+
+		switch (pass) {
+			case Pass::Opaque:
+				return head | (mat << 32) | sortable_bits(depth);
+			case Pass::Transparent:
+				// Farthest first
+				return head | (static_cast<std::uint64_t>(~sortable_bits(depth)) << k_material_bits) | mat;
+			case Pass::Sprite:
+				return head | (static_cast<std::uint64_t>(sortable_bits(depth)) << k_material_bits) | mat;
+		}
+		return head;
+	}
+
+	void radix_sort(std::span<DrawPacket> packets, std::span<DrawPacket> scratch) {
+		const std::size_t n = packets.size();
+		if (n < 2) return;
+
+		// All 8 histograms in one pass
+		std::size_t counts[8][256] = {};
+		for (const DrawPacket& p : packets)
+			for (int b = 0; b < 8; ++b)
+				++counts[b][(p.key >> (b * 8)) & 0xFF];
+
+		DrawPacket* src = packets.data();
+		DrawPacket* dst = scratch.data();
+
+		for (int b = 0; b < 8; ++b) {
+			std::size_t* count = counts[b];
+
+			// Every key has the same byte here: nothing to reorder
+			if (count[(src[0].key >> (b * 8)) & 0xFF] == n) continue;
+
+			std::size_t offset = 0;
+			for (int i = 0; i < 256; ++i) {
+				const std::size_t c = count[i];
+				count[i] = offset;
+				offset += c;
+			}
+
+			for (std::size_t i = 0; i < n; ++i)
+				dst[count[(src[i].key >> (b * 8)) & 0xFF]++] = src[i];
+
+			std::swap(src, dst);
+		}
+
+		if (src != packets.data())
+			std::memcpy(packets.data(), src, n * sizeof(DrawPacket));
+	}
+
+} // namespace me::render
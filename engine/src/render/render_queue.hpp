@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace me::render {
+
+	// Order of passes inside a layer
+	enum class Pass : std::uint8_t {
+		Opaque = 0,
+		Transparent = 1,
+		Sprite = 2,
+	};
+
+	// One draw in a flat render list. Sorting by `key` gives the submission order;
+	// consecutive packets with the same `batch` can be drawn with one call.
+	struct DrawPacket {
+		std::uint64_t key;
+		std::uint32_t batch;     // layer | pass | material, without depth
+		std::uint32_t index;     // Into the frame's payload array
+	};
+
+	constexpr std::uint32_t k_material_bits = 20;
+	constexpr std::uint32_t k_material_mask = (1u << k_material_bits) - 1;
+
+	// Sort key, most significant first:
+	//   Opaque:                  layer(8) | pass(4) | material(20) | depth(32)    front-to-back per material
+	//   Transparent and sprites: layer(8) | pass(4) | depth(32) | material(20)    back-to-front / painter's order
+	// `depth` is any float where smaller means closer (3D) or drawn first (2D).
+	std::uint64_t make_sort_key(std::uint8_t layer, Pass pass, std::uint32_t material, float depth);
+
+	constexpr std::uint32_t make_batch(std::uint8_t layer, Pass pass, std::uint32_t material) {
+		return (static_cast<std::uint32_t>(layer) << 24) | (static_cast<std::uint32_t>(pass) << k_material_bits) | (material & k_material_mask);
+	}
+
+	// Stable LSD radix sort on DrawPacket::key (8 bits per pass, passes where every key shares the byte are skipped).
+	// `scratch` must be at least as large as `packets`. The sorted result is always left in `packets`.
+	void radix_sort(std::span<DrawPacket> packets, std::span<DrawPacket> scratch);
+
+} // namespace me::render
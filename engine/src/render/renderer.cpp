@@ -1,10 +1,16 @@
 #include "../assets/assets_internal.hpp"
+#include "../platform/platform.hpp"
+#include "render_internal.hpp"
+#include "lod.hpp"
+#include "mesh_instancing.hpp"
+#include "sprite_batch.hpp"
 
 #include <mini-ecs/registry.hpp>
 
 #include "mini-engine-raylib/render/renderer.hpp"
 #include "mini-engine-raylib/ecs/components.hpp"
 #include "mini-engine-raylib/core/engine.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
 
 #include <raylib.h>
 #include <rlgl.h>
@@ -15,133 +21,122 @@ namespace me::render {
 		return ::Color{ c.r, c.g, c.b, c.a };
 	}
 
-	void clear_world(me::Color color) {
-		ClearBackground(to_ray(color));
-	}
+	// Immediate-mode fallback: one matrix push and one raylib shape per packet
+	static void draw_immediate(const MeshDraw& draw) {
+		::Color col = to_ray(draw.color);
 
-	void render_world() {
-		auto& reg = me::get_registry();
+		rlPushMatrix();
+		rlMultMatrixf(draw.model);
 
-		Camera3D rayCam = { 0 };
-		rayCam.position = { 10.0f, 10.0f, 10.0f };
-		rayCam.target = { 0.0f, 0.0f, 0.0f };
-		rayCam.up = { 0.0f, 1.0f, 0.0f };
-		rayCam.fovy = 45.0f;
-		rayCam.projection = CAMERA_PERSPECTIVE;
-
-		auto& camPool = reg.view<me::components::CameraComponent>();
-
-		for (size_t i = 0; i < camPool.size(); ++i) {
-			me::entity::entity_id e = camPool.entity_map[i];
-			auto& cam = camPool.components[i];
-
-			if (cam.active) {
-				auto* t = reg.try_get_component<me::components::TransformComponent>(e);
-				if (t) {
-					rayCam.position = { t->x, t->y, t->z };
-					rayCam.target = { cam.target_x, cam.target_y, cam.target_z };
-					rayCam.up = { cam.up_x, cam.up_y, cam.up_z };
-					rayCam.fovy = cam.fov;
-					rayCam.projection = cam.projection;
-					break;
-				}
-			}
-		}
+		if (draw.type == me::components::MeshRendererComponent::Cube) {
+			if (draw.wireframe) DrawCubeWires({ 0,0,0 }, 2.0f, 2.0f, 2.0f, col);
+			else DrawCube({ 0,0,0 }, 2.0f, 2.0f, 2.0f, col);
 
-		BeginMode3D(rayCam);
-		DrawGrid(20, 1.0f);
+		} else if (draw.type == me::components::MeshRendererComponent::Sphere) {
+			const int rings = k_sphere_lod[draw.lod][0], slices = k_sphere_lod[draw.lod][1];
+			if (draw.wireframe) DrawSphereWires({ 0,0,0 }, 1.0f, rings, slices, col);
+			else DrawSphereEx({ 0,0,0 }, 1.0f, rings, slices, col);
 
-		auto& meshPool = reg.view<me::components::MeshRendererComponent>();
+		} else if (draw.type == me::components::MeshRendererComponent::Plane) {
+			DrawPlane({ 0,0,0 }, { 2.0f, 2.0f }, col);
+		}
 
-		for (size_t i = 0; i < meshPool.size(); ++i) {
-			me::entity::entity_id e = meshPool.entity_map[i];
-			auto& mesh = meshPool.components[i];
+		rlPopMatrix();
+	}
 
-			auto* t = reg.try_get_component<me::components::TransformComponent>(e);
-			if (!t) continue;
+	void clear_world(me::Color color) {
+		if (me::platform::is_headless()) return;
+		ClearBackground(to_ray(color));
+	}
 
-			Vector3 pos = { t->x, t->y, t->z };
-			Vector3 size = { t->sx, t->sy, t->sz };
-			::Color col = to_ray(mesh.color);
+	void render_world() {
+		ME_PROFILE_SCOPE("render::render_world");
+		if (me::platform::is_headless()) return;
 
-			rlPushMatrix();
-			rlTranslatef(pos.x, pos.y, pos.z);
-			rlRotatef(t->rot_z, 0, 0, 1);
-			rlRotatef(t->rot_y, 0, 1, 0);
-			rlRotatef(t->rot_x, 1, 0, 0);
-			rlScalef(size.x, size.y, size.z);
+		ViewParams view;
+		const int height = GetScreenHeight();
+		if (height > 0) view.aspect = static_cast<float>(GetScreenWidth()) / static_cast<float>(height);
+		view.screen_height = static_cast<float>(height);
+		view.near_plane = static_cast<float>(rlGetCullDistanceNear());
+		view.far_plane = static_cast<float>(rlGetCullDistanceFar());
 
-			if (mesh.type == me::components::MeshRendererComponent::Cube) {
-				if (mesh.wireframe) DrawCubeWires({ 0,0,0 }, 2.0f, 2.0f, 2.0f, col);
-				else DrawCube({ 0,0,0 }, 2.0f, 2.0f, 2.0f, col);
+		// 1. Extract: registry -> sorted packets (parallel, no GPU)
+		const WorldFrame& frame = internal_build_world(me::get_registry(), view);
 
-			} else if (mesh.type == me::components::MeshRendererComponent::Sphere) {
-				if (mesh.wireframe) DrawSphereWires({ 0,0,0 }, 1.0f, 16, 16, col);
-				else DrawSphere({ 0,0,0 }, 1.0f, col);
+		Camera3D rayCam = { 0 };
+		rayCam.position = { frame.camera.position[0], frame.camera.position[1], frame.camera.position[2] };
+		rayCam.target = { frame.camera.target[0], frame.camera.target[1], frame.camera.target[2] };
+		rayCam.up = { frame.camera.up[0], frame.camera.up[1], frame.camera.up[2] };
+		rayCam.fovy = frame.camera.fovy;
+		rayCam.projection = frame.camera.projection;
 
-			} else if (mesh.type == me::components::MeshRendererComponent::Plane) {
-				DrawPlane({ 0,0,0 }, { 2.0f, 2.0f }, col);
-			}
+		// 2. Submit in packet order
+		BeginMode3D(rayCam);
+		DrawGrid(20, 1.0f);
 
-			rlPopMatrix();
+		// Immediate mode (one draw per packet) only when the GL context can't instance
+		if (!internal_draw_meshes_instanced(frame)) {
+			for (const DrawPacket& packet : frame.packets) draw_immediate(frame.meshes[packet.index]);
 		}
 
 		EndMode3D();
 	}
 
 	void render_2d() {
-		auto& reg = me::get_registry();
+		ME_PROFILE_SCOPE("render::render_2d");
+		if (me::platform::is_headless()) return;
+
+		// 1. Extract: registry -> sorted packets (parallel, no GPU)
+		const SpriteFrame& frame = internal_build_sprites(me::get_registry());
 
-		// 1. Setup the 2D Camera
 		::Camera2D ray_cam2d = { 0 };
-		ray_cam2d.zoom = 1.0f;
-
-		auto& cam2d_pool = reg.view<me::components::Camera2DComponent>();
-		for (size_t i = 0; i < cam2d_pool.size(); ++i) {
-			me::entity::entity_id e = cam2d_pool.entity_map[i];
-			auto& cam = cam2d_pool.components[i];
-
-			if (cam.active) {
-				auto* t = reg.try_get_component<me::components::TransformComponent>(e);
-				if (t) {
-					ray_cam2d.target = { t->x, t->y }; // Camera follows Transform's X/Y
-					ray_cam2d.offset = { cam.offset_x, cam.offset_y };
-					ray_cam2d.rotation = cam.rotation;
-					ray_cam2d.zoom = cam.zoom;
-					break;
-				}
-			}
-		}
+		ray_cam2d.target = { frame.camera.target[0], frame.camera.target[1] };
+		ray_cam2d.offset = { frame.camera.offset[0], frame.camera.offset[1] };
+		ray_cam2d.rotation = frame.camera.rotation;
+		ray_cam2d.zoom = frame.camera.zoom;
 
-		// 2. Start Drawing 2D World
+		// 2. Submit in packet order: by layer, then z, then texture
 		BeginMode2D(ray_cam2d);
 
-		auto& sprite_pool = reg.view<me::components::SpriteComponent>();
-		for (size_t i = 0; i < sprite_pool.size(); ++i) {
-			me::entity::entity_id e = sprite_pool.entity_map[i];
-			auto& sprite = sprite_pool.components[i];
+		if (internal_draw_sprites_batched(frame)) {
+			EndMode2D();
+			return;
+		}
+
+		// Fallback without vertex arrays: one DrawTexturePro per sprite
+		me::assets::TextureId bound{};
+		const ::Texture2D* tex = nullptr;
 
-			auto* t = reg.try_get_component<me::components::TransformComponent>(e);
-			if (!t) continue;
+		for (const DrawPacket& packet : frame.packets) {
+			const SpriteDraw& sprite = frame.sprites[packet.index];
 
-			// Fetch the raw Raylib Texture
-			const ::Texture2D* tex = me::assets::internal_get_texture(sprite.texture);
-			if (tex) {
-				// Source rect (entire image)
-				::Rectangle source = { 0.0f, 0.0f, (float)tex->width, (float)tex->height };
+			// Only resolve the texture when it changes between packets
+			if (sprite.texture.handle != bound.handle || tex == nullptr) {
+				bound = sprite.texture;
+				tex = me::assets::internal_get_texture(sprite.texture);
+			}
+			if (!tex) continue;
 
-				// Destination rect (Position and Scaled Size)
-				::Rectangle dest = { t->x, t->y, tex->width * t->sx, tex->height * t->sy };
+			// Source rect (the sprite's uv rect, the whole image by default)
+			const float w = (float)tex->width, h = (float)tex->height;
+			::Rectangle source = { sprite.uv.u0 * w, sprite.uv.v0 * h, (sprite.uv.u1 - sprite.uv.u0) * w, (sprite.uv.v1 - sprite.uv.v0) * h };
 
-				// Origin is the center of the sprite so it rotates correctly
-				::Vector2 origin = { dest.width / 2.0f, dest.height / 2.0f };
+			// Destination rect (Position and Scaled Size)
+			::Rectangle dest = { sprite.x, sprite.y, source.width * sprite.sx, source.height * sprite.sy };
 
-				// Draw it using Transform's rot_z for 2D rotation
-				DrawTexturePro(*tex, source, dest, origin, t->rot_z, to_ray(sprite.tint));
-			}
+			// Origin is the center of the sprite so it rotates correctly
+			::Vector2 origin = { dest.width / 2.0f, dest.height / 2.0f };
+
+			// Draw it using Transform's rot_z for 2D rotation
+			DrawTexturePro(*tex, source, dest, origin, sprite.rotation, to_ray(sprite.tint));
 		}
 
 		EndMode2D();
 	}
 
+	void internal_shutdown() {
+		internal_release_instancing();
+		internal_release_sprite_batcher();
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,13 @@
+#include "mini-engine-raylib/render/renderer.hpp"
+#include "render_internal.hpp"
+
+// Renderer for builds without raylib (ME_WITH_RAYLIB=OFF): nothing is drawn.
+namespace me::render {
+
+	void clear_world(me::Color) {}
+	void render_world() {}
+	void render_2d() {}
+
+	void internal_shutdown() {}
+
+} // namespace me::render
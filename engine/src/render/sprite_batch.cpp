@@ -0,0 +1,73 @@
+#include "sprite_batch.hpp"
+
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define ME_SPRITE_SSE 1
+#include <xmmintrin.h>
+#else
+#define ME_SPRITE_SSE 0
+#endif
+
+namespace me::render {
+
+	void internal_build_sprite_quads(const SpriteFrame& frame, std::size_t first, std::size_t count, float tex_w, float tex_h, SpriteVertex* out) {
+		constexpr float k_deg2rad = 3.14159265358979323846f / 180.0f;
+
+#if ME_SPRITE_SSE
+		// Corner offsets from the center in half-extents: (-1,-1) (-1,1) (1,1) (1,-1)
+		const __m128 sign_x = _mm_setr_ps(-1.0f, -1.0f, 1.0f, 1.0f);
+		const __m128 sign_y = _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f);
+#endif
+
+		for (std::size_t i = 0; i < count; ++i) {
+			const SpriteDraw& sprite = frame.sprites[frame.packets[first + i].index];
+			SpriteVertex* quad = out + i * 4;
+
+			// Drawn at the sub-rectangle's pixel size
+			const me::assets::UvRect& uv = sprite.uv;
+			const float hw = tex_w * (uv.u1 - uv.u0) * sprite.sx * 0.5f;
+			const float hh = tex_h * (uv.v1 - uv.v0) * sprite.sy * 0.5f;
+
+			float c = 1.0f, s = 0.0f;
+			if (sprite.rotation != 0.0f) {
+				c = std::cos(sprite.rotation * k_deg2rad);
+				s = std::sin(sprite.rotation * k_deg2rad);
+			}
+
+			float xs[4], ys[4];
+#if ME_SPRITE_SSE
+			// x' = x + dx*c - dy*s, y' = y + dx*s + dy*c for all four corners at once
+			const __m128 dx = _mm_mul_ps(sign_x, _mm_set1_ps(hw));
+			const __m128 dy = _mm_mul_ps(sign_y, _mm_set1_ps(hh));
+			const __m128 vc = _mm_set1_ps(c);
+			const __m128 vs = _mm_set1_ps(s);
+			_mm_storeu_ps(xs, _mm_add_ps(_mm_set1_ps(sprite.x), _mm_sub_ps(_mm_mul_ps(dx, vc), _mm_mul_ps(dy, vs))));
+			_mm_storeu_ps(ys, _mm_add_ps(_mm_set1_ps(sprite.y), _mm_add_ps(_mm_mul_ps(dx, vs), _mm_mul_ps(dy, vc))));
+#else
+			for (int k = 0; k < 4; ++k) {
+				const float dx = (k < 2 ? -hw : hw);
+				const float dy = (k == 0 || k == 3 ? -hh : hh);
+				xs[k] = sprite.x + dx * c - dy * s;
+				ys[k] = sprite.y + dx * s + dy * c;
+			}
+#endif
+
+			// Same corner order as DrawTexturePro's quad
+			const float tex_u[4] = { uv.u0, uv.u0, uv.u1, uv.u1 };
+			const float tex_v[4] = { uv.v0, uv.v1, uv.v1, uv.v0 };
+
+			for (int k = 0; k < 4; ++k) {
+				quad[k].x = xs[k];
+				quad[k].y = ys[k];
+				quad[k].u = tex_u[k];
+				quad[k].v = tex_v[k];
+				quad[k].color[0] = sprite.tint.r;
+				quad[k].color[1] = sprite.tint.g;
+				quad[k].color[2] = sprite.tint.b;
+				quad[k].color[3] = sprite.tint.a;
+			}
+		}
+	}
+
+} // namespace me::render
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "render_internal.hpp"
+
+#include <cstddef>
+
+namespace me::render {
+
+	// One corner of a sprite quad, in the layout raylib's default shader reads
+	// (vertexPosition at 0, vertexTexCoord at 1, vertexColor at 3)
+	struct SpriteVertex {
+		float x, y;
+		float u, v;
+		unsigned char color[4];
+	};
+
+	// Writes 4 vertices per packet (top-left, bottom-left, bottom-right, top-right) for packets
+	// [first, first + count) of the frame. All of them must share one texture of tex_w x tex_h.
+	// Matches DrawTexturePro with the sprite's uv rect as source and the origin at the center.
+	// Rotation is applied on the CPU, SSE across the 4 corners when available.
+	void internal_build_sprite_quads(const SpriteFrame& frame, std::size_t first, std::size_t count, float tex_w, float tex_h, SpriteVertex* out);
+
+#if ME_HAS_RAYLIB
+	// Internal-only (raylib builds): draws the frame's sprites from one dynamic vertex buffer, one draw call
+	// per run of packets sharing a texture (or per full buffer). Must be called between BeginMode2D/EndMode2D.
+	// Returns false if the GL context has no vertex arrays (GL 1.1/2.1, ES 2.0) so the caller can fall back.
+	bool internal_draw_sprites_batched(const SpriteFrame& frame);
+
+	// Frees the sprite vertex buffers
+	void internal_release_sprite_batcher();
+#endif
+
+} // namespace me::render
@@ -0,0 +1,139 @@
+#include "sprite_batch.hpp"
+#include "../assets/assets_internal.hpp"
+
+#include "mini-engine-raylib/core/profiler.hpp"
+
+#include <raylib.h>
+#include <raymath.h>
+#include <rlgl.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace me::render {
+
+	namespace {
+		// Quads per flush. Indices are 16-bit in rlgl, so 4 * k_max_quads must stay <= 65536.
+		constexpr std::size_t k_max_quads = 16384;
+
+		enum class State { Uninitialized, Ready, Unsupported };
+
+		State s_state = State::Uninitialized;
+		unsigned int s_vao = 0;
+		unsigned int s_vbo = 0;
+		unsigned int s_ebo = 0;
+		std::vector<SpriteVertex> s_vertices;
+
+		bool init() {
+			const int gl = rlGetVersion();
+			if (gl != RL_OPENGL_33 && gl != RL_OPENGL_43 && gl != RL_OPENGL_ES_30) return false;
+
+			s_vao = rlLoadVertexArray();
+			if (s_vao == 0) return false;
+			rlEnableVertexArray(s_vao);
+
+			s_vertices.resize(k_max_quads * 4);
+			s_vbo = rlLoadVertexBuffer(nullptr, static_cast<int>(s_vertices.size() * sizeof(SpriteVertex)), true);
+
+			constexpr int stride = sizeof(SpriteVertex);
+			rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 2, RL_FLOAT, false, stride, static_cast<int>(offsetof(SpriteVertex, x)));
+			rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+			rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, false, stride, static_cast<int>(offsetof(SpriteVertex, u)));
+			rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+			rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, true, stride, static_cast<int>(offsetof(SpriteVertex, color)));
+			rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+
+			// Static index buffer: two triangles per quad, same winding as raylib's own batch
+			std::vector<unsigned short> indices(k_max_quads * 6);
+			for (std::size_t q = 0; q < k_max_quads; ++q) {
+				const auto base = static_cast<unsigned short>(q * 4);
+				unsigned short* tri = &indices[q * 6];
+				tri[0] = base; tri[1] = base + 1; tri[2] = base + 2;
+				tri[3] = base; tri[4] = base + 2; tri[5] = base + 3;
+			}
+			s_ebo = rlLoadVertexBufferElement(indices.data(), static_cast<int>(indices.size() * sizeof(unsigned short)), false);
+
+			rlDisableVertexArray();
+			return true;
+		}
+
+		void flush(std::size_t quads) {
+			rlEnableVertexArray(s_vao);
+			rlUpdateVertexBuffer(s_vbo, s_vertices.data(), static_cast<int>(quads * 4 * sizeof(SpriteVertex)), 0);
+			rlDrawVertexArrayElements(0, static_cast<int>(quads * 6), nullptr);
+			rlDisableVertexArray();
+		}
+	} // namespace
+
+	bool internal_draw_sprites_batched(const SpriteFrame& frame) {
+		ME_PROFILE_SCOPE("render::draw_sprites");
+
+		if (s_state == State::Uninitialized)
+			s_state = init() ? State::Ready : State::Unsupported;
+		if (s_state != State::Ready) return false;
+
+		const auto& packets = frame.packets;
+		if (packets.empty()) return true;
+
+		// Flush raylib's immediate batch so draw order is kept
+		rlDrawRenderBatchActive();
+
+		const Matrix model_view = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+		const Matrix mvp = MatrixMultiply(model_view, rlGetMatrixProjection());
+		const int* locs = rlGetShaderLocsDefault();
+		const float white[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+		rlEnableShader(rlGetShaderIdDefault());
+		rlSetUniformMatrix(locs[SHADER_LOC_MATRIX_MVP], mvp);
+		rlSetUniform(locs[SHADER_LOC_COLOR_DIFFUSE], white, RL_SHADER_UNIFORM_VEC4, 1);
+		rlActiveTextureSlot(0);
+
+		// Packets are in painter's order; consecutive ones sharing a texture go out in one draw,
+		// whatever their layer or z
+		int batches = 0;
+		std::size_t quads = 0;
+		std::size_t run_begin = 0;
+		while (run_begin < packets.size()) {
+			const me::assets::TextureId texture = frame.sprites[packets[run_begin].index].texture;
+			std::size_t run_end = run_begin + 1;
+			while (run_end < packets.size() && frame.sprites[packets[run_end].index].texture.handle == texture.handle) ++run_end;
+
+			// One lookup per run instead of per sprite
+			const ::Texture2D* tex = me::assets::internal_get_texture(texture);
+			if (tex) {
+				rlEnableTexture(tex->id);
+				for (std::size_t first = run_begin; first < run_end; first += k_max_quads) {
+					const std::size_t count = std::min(k_max_quads, run_end - first);
+					internal_build_sprite_quads(frame, first, count, static_cast<float>(tex->width), static_cast<float>(tex->height), s_vertices.data());
+					flush(count);
+					++batches;
+					quads += count;
+				}
+			}
+			run_begin = run_end;
+		}
+
+		rlDisableTexture();
+		rlDisableShader();
+
+		ME_PROFILE_COUNTER("render::sprite_batches", batches);
+		ME_PROFILE_COUNTER("render::sprite_quads", quads);
+		(void)batches;
+		(void)quads;
+		return true;
+	}
+
+	void internal_release_sprite_batcher() {
+		if (s_ebo != 0) rlUnloadVertexBuffer(s_ebo);
+		if (s_vbo != 0) rlUnloadVertexBuffer(s_vbo);
+		if (s_vao != 0) rlUnloadVertexArray(s_vao);
+		s_ebo = 0;
+		s_vbo = 0;
+		s_vao = 0;
+		s_vertices.clear();
+		s_vertices.shrink_to_fit();
+		s_state = State::Uninitialized;
+	}
+
+} // namespace me::render
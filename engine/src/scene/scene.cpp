@@ -1,16 +1,25 @@
 #include "mini-engine-raylib/scene/scene.hpp"
+#include "mini-engine-raylib/scene/scene_file.hpp"
 #include "mini-engine-raylib/core/engine.hpp"
+#include "mini-engine-raylib/ecs/commands.hpp"
 #include "mini-engine-raylib/ecs/components.hpp"
+#include "mini-engine-raylib/ecs/serialize.hpp"
+#include "mini-engine-raylib/ecs/snapshot.hpp"
+#include "mini-engine-raylib/ecs/transform_system.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+#include "mini-engine-raylib/core/jobs.hpp"
 
 #include <mini-ecs/registry.hpp>
 
-#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <unordered_map>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <vector>
 
-using json = nlohmann::ordered_json;
 namespace fs = std::filesystem;
 
 namespace me {
@@ -23,6 +32,7 @@ namespace me {
 		namespace {
 			std::unordered_map<std::string, Scene*> s_scenes;
 			std::string s_current_name;
+			snapshot::Snapshot s_loaded;   // Registry right after the current scene's file loaded (can_restart() scenes only)
 		}
 
 		void register_scene(Scene* scene) {
@@ -57,12 +67,32 @@ namespace me {
 
 			Scene* scene = s_scenes[name];
 			scene->load_from_file(); // Load JSON if it has one
+			s_loaded = scene->can_restart() ? snapshot::capture(me::get_registry()) : snapshot::Snapshot{};
 
 			s_current_name = name;
 			scene->on_enter();
 		}
 
+		bool restart() {
+			Scene* scene = current();
+			if (!scene) return false;
+			if (!scene->can_restart()) {
+				std::cerr << "Scene can't restart: " << s_current_name << " (override Scene::can_restart)\n";
+				return false;
+			}
+
+			// Whatever on_enter spawned was created after the snapshot, so the restore removes it and on_enter runs fresh
+			scene->on_exit();
+			const bool restored = snapshot::restore(me::get_registry(), s_loaded);
+			if (!restored) std::cerr << "Scene restart failed to restore: " << s_current_name << "\n";
+
+			// Re-entered either way so the level keeps its systems
+			scene->on_enter();
+			return restored;
+		}
+
 		void update(float dt) {
+			ME_PROFILE_SCOPE("scene_manager::update");
 			if (!s_current_name.empty() && s_scenes[s_current_name])
 				s_scenes[s_current_name]->on_update(dt);
 		}
@@ -87,73 +117,168 @@ namespace me {
 	}
 
 	// ===================================================================
-	// SCENE SERIALIZATION (JSON SAVE/LOAD)
+	// SYSTEM SCHEDULING
 	// ===================================================================
 
-	bool Scene::save_to_file() const {
-		const char* filename = get_file();
-		if (!filename || !*filename) return false;
+	std::vector<Scene::ScheduledSystem> Scene::build_schedule() const {
+		std::vector<ScheduledSystem> schedule(m_systems.size());
+
+		for (std::size_t i = 0; i < m_systems.size(); ++i) {
+			auto& node = schedule[i];
+			node.access = m_systems[i]->get_access();
+
+			// Registration order decides every conflicting pair
+			for (std::size_t j = 0; j < i; ++j) {
+				if (!node.access.conflicts_with(schedule[j].access)) continue;
+				node.after.push_back(j);
+				node.stage = std::max(node.stage, schedule[j].stage + 1);
+			}
+		}
+		return schedule;
+	}
 
-		json root; root["entities"] = json::array();
+	void Scene::on_update(float dt) {
 		auto& reg = me::get_registry();
-		auto& transforms = reg.view<me::components::TransformComponent>();
 
-		for (size_t i = 0; i < transforms.size(); ++i) {
-			me::entity::entity_id e = transforms.entity_map[i];
-			auto& t = transforms.components[i];
-			if (!reg.is_alive(e)) continue;
+		if (m_schedule.size() != m_systems.size())
+			m_schedule = build_schedule();
 
-			json je;
-			je["id"] = static_cast<uint32_t>(e);
+		if (me::jobs::worker_count() == 0 || m_systems.size() < 2) {
+			for (auto& sys : m_systems) {
+				ME_PROFILE_SCOPE(sys->get_name());
+				sys->on_update(reg, dt);
+			}
+			me::commands::flush(reg);
+			return;
+		}
+
+		// Workers must never insert a pool into the registry, so create every declared one here
+		for (const auto& node : m_schedule) {
+			for (const auto& e : node.access.reads) e.ensure_pool(reg);
+			for (const auto& e : node.access.writes) e.ensure_pool(reg);
+		}
 
-			json comps = json::object();
-			comps["Transform"] = json{ {"x", t.x}, {"y", t.y}, {"z", t.z}, {"rot_x", t.rot_x}, {"rot_y", t.rot_y}, {"rot_z", t.rot_z}, {"sx", t.sx}, {"sy", t.sy}, {"sz", t.sz} };
+		std::vector<me::jobs::Handle> handles(m_systems.size());
+		std::vector<me::jobs::Handle> deps;
 
-			if (auto* c = reg.try_get_component<me::components::Camera2DComponent>(e)) {
-				comps["Camera2D"] = json{ {"offset_x", c->offset_x}, {"offset_y", c->offset_y}, {"zoom", c->zoom}, {"rotation", c->rotation} };
+		for (std::size_t i = 0; i < m_systems.size(); ++i) {
+			System* sys = m_systems[i].get();
+
+			// Exclusive systems keep their old contract: main thread, nothing else running
+			if (m_schedule[i].access.exclusive) {
+				for (std::size_t j = 0; j < i; ++j) me::jobs::wait(handles[j]);
+
+				ME_PROFILE_SCOPE(sys->get_name());
+				sys->on_update(reg, dt);
+				continue;
 			}
 
-			je["components"] = std::move(comps);
-			root["entities"].push_back(std::move(je));
+			deps.clear();
+			for (std::size_t j : m_schedule[i].after) deps.push_back(handles[j]);
+
+			handles[i] = me::jobs::submit([sys, &reg, dt]() {
+				ME_PROFILE_SCOPE(sys->get_name());
+				sys->on_update(reg, dt);
+			}, deps);
 		}
 
-		fs::path fullPath = fs::current_path() / "scenes" / filename;
-		std::ofstream ofs(fullPath, std::ios::binary);
-		if (!ofs) return false;
-		ofs << root.dump(2);
-		return true;
+		for (const auto& h : handles) me::jobs::wait(h);
+
+		// Sync point: every system is done, apply what they deferred
+		me::commands::flush(reg);
 	}
 
-	bool Scene::load_from_file() const {
-		const char* filename = get_file();
-		if (!filename || !*filename) return false;
+	std::string Scene::dump_schedule() const {
+		const auto schedule = build_schedule();
 
-		fs::path fullPath = fs::current_path() / "scenes" / filename;
-		std::ifstream ifs(fullPath, std::ios::binary);
-		if (!ifs) return false;
+		int stages = 0;
+		for (const auto& node : schedule) stages = std::max(stages, node.stage + 1);
 
-		json root;
-		try { ifs >> root; } catch (...) { return false; }
+		std::ostringstream out;
+		out << "Schedule for '" << get_name() << "': " << schedule.size() << " systems, " << stages << " stages\n";
 
-		auto& reg = me::get_registry();
-		if (!root.contains("entities") || !root["entities"].is_array()) return true;
+		for (int stage = 0; stage < stages; ++stage) {
+			out << "  stage " << stage << "\n";
+
+			for (std::size_t i = 0; i < schedule.size(); ++i) {
+				const auto& node = schedule[i];
+				if (node.stage != stage) continue;
 
-		for (const auto& je : root["entities"]) {
-			me::Entity e = reg.create_entity("Entity");
-			if (!je.contains("components")) continue;
-			const auto& comps = je["components"];
+				out << "    [" << i << "] " << m_systems[i]->get_name();
 
-			if (comps.contains("Transform")) {
-				auto& j = comps["Transform"];
-				reg.add_component(e, me::components::TransformComponent{ j.value("x", 0.f), j.value("y", 0.f), j.value("z", 0.f), j.value("rot_x", 0.f), j.value("rot_y", 0.f), j.value("rot_z", 0.f), j.value("sx", 1.f), j.value("sy", 1.f), j.value("sz", 1.f) });
+				if (node.access.exclusive) {
+					out << " (exclusive)";
+				} else {
+					out << " reads:";
+					for (const auto& e : node.access.reads) out << ' ' << e.name;
+					out << " writes:";
+					for (const auto& e : node.access.writes) out << ' ' << e.name;
+				}
+
+				if (!node.after.empty()) {
+					out << " after:";
+					for (std::size_t j : node.after) out << " [" << j << "]";
+				}
+				out << "\n";
 			}
+		}
+		return out.str();
+	}
 
-			if (comps.contains("Camera2D")) {
-				auto& j = comps["Camera2D"];
-				reg.add_component(e, me::components::Camera2DComponent{ j.value("offset_x", 0.f), j.value("offset_y", 0.f), j.value("rotation", 0.f), j.value("zoom", 1.f), true });
+	// ===================================================================
+	// SCENE SERIALIZATION (JSON SAVE/LOAD)
+	// ===================================================================
+
+	bool Scene::save_to_file() const {
+		const char* filename = get_file();
+		if (!filename || !*filename) return false;
+
+		if (!scene_file::save(fs::current_path() / "scenes" / filename)) return false;
+		mark_saved();
+		return true;
+	}
+
+	bool Scene::load_from_file() const {
+		const char* filename = get_file();
+		if (!filename || !*filename) return false;
+
+		// A cooked binary next to the JSON wins unless the JSON was saved after it
+		fs::path path = fs::current_path() / "scenes" / filename;
+		fs::path binary = path;
+		binary.replace_extension(scene_file::k_binary_extension);
+		std::error_code ec;
+		if (binary != path && fs::exists(binary, ec)) {
+			const auto binary_time = fs::last_write_time(binary, ec);
+			if (!ec && (!fs::exists(path, ec) || fs::last_write_time(path, ec) <= binary_time) && scene_file::load_binary(binary)) {
+				mark_saved();
+				return true;
 			}
 		}
+
+		if (!scene_file::load(path)) return false;
+		mark_saved();
 		return true;
 	}
 
+	void Scene::mark_saved() const {
+		if (!tracks_unsaved_changes()) return;
+
+		// Rescan even if this tick was already scanned: writes since then are in the file. Transform ticks come
+		// from the transform cache, so bring that up to date too.
+		auto& reg = me::get_registry();
+		me::transform::update();
+		for (const auto& ops : serialize::components()) ops.version(reg, true);
+		changes::track<me::components::ParentComponent>(reg).update(reg, changes::tick());
+		m_saved_tick = changes::tick();
+	}
+
+	bool Scene::has_unsaved_changes() const {
+		if (!tracks_unsaved_changes()) return false;
+
+		auto& reg = me::get_registry();
+		for (const auto& ops : serialize::components())
+			if (ops.version(reg, false) > m_saved_tick) return true;
+		return changes::track<me::components::ParentComponent>(reg).version() > m_saved_tick;
+	}
+
 } // namespace me
\ No newline at end of file
@@ -0,0 +1,519 @@
+#include "mini-engine-raylib/scene/scene_file.hpp"
+#include "mini-engine-raylib/core/engine.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+#include "mini-engine-raylib/ecs/components.hpp"
+#include "mini-engine-raylib/ecs/reflect.hpp"
+#include "mini-engine-raylib/ecs/serialize.hpp"
+#include "mini-engine-raylib/ecs/transform_system.hpp"
+#include "mini-engine-raylib/ecs/view.hpp"
+#include "../core/lz.hpp"
+#include "scene_file_internal.hpp"
+
+#include <mini-ecs/registry.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace me::scene_file {
+
+	// File layout (little-endian). Every section starts 8-byte aligned.
+	//   header:  "MESCENE\0", u32 version, u32 entity count, u32 pool count, u32 string count
+	//   pools:   u32 name length, u32 component count, u32 column count, u32 0, name
+	//            block: file row of each component's entity (u32, rows are 0..entity count-1)
+	//            columns: u32 name length, u8 ColumnKind, u8 0, u16 width, name, block
+	//   strings: block: u32 offset per string plus one end offset, then the null-terminated strings
+	// Every block: u32 raw size, u32 stored size, u32 codec (0 = raw, 1 = LZ), u32 0, then the stored bytes.
+	// ParentComponent is the pool "Parent" with one column "id": the parent's row.
+
+	namespace {
+		using me::components::ParentComponent;
+		using me::components::TransformComponent;
+		using serialize::ColumnKind;
+
+		constexpr char k_magic[8] = { 'M', 'E', 'S', 'C', 'E', 'N', 'E', '\0' };
+		constexpr std::uint32_t k_codec_raw = 0;
+		constexpr std::uint32_t k_codec_lz = 1;
+		constexpr std::size_t k_min_compress = 64;      // Smaller blocks are stored raw
+		constexpr std::uint32_t k_none = serialize::detail::PoolWriter::none;
+
+		std::size_t padded(std::size_t size) { return (size + 7) & ~std::size_t{ 7 }; }
+
+		// ---------------- writing ----------------
+
+		class Writer final : public serialize::detail::PoolWriter {
+		public:
+			Writer(std::vector<std::uint32_t> slot_rows, bool compress) : m_slot_rows(std::move(slot_rows)), m_compress(compress) {
+				intern("");   // Index 0: empty string / no texture
+			}
+
+			template <typename T>
+			void put(const T& v) {
+				const auto* p = reinterpret_cast<const std::byte*>(&v);
+				m_out.insert(m_out.end(), p, p + sizeof(T));
+			}
+
+			void put_name(std::string_view name) {
+				m_out.insert(m_out.end(), reinterpret_cast<const std::byte*>(name.data()), reinterpret_cast<const std::byte*>(name.data()) + name.size());
+				m_out.resize(padded(m_out.size()));
+			}
+
+			void put_block(const void* data, std::size_t size) {
+				const auto* bytes = static_cast<const std::byte*>(data);
+				m_scratch.clear();
+				if (m_compress && size >= k_min_compress) lz::internal_compress(bytes, size, m_scratch);
+
+				const bool lz = !m_scratch.empty() && m_scratch.size() <= size - size / 8;
+				put(static_cast<std::uint32_t>(size));
+				put(static_cast<std::uint32_t>(lz ? m_scratch.size() : size));
+				put(lz ? k_codec_lz : k_codec_raw);
+				put(std::uint32_t{ 0 });
+				if (lz) m_out.insert(m_out.end(), m_scratch.begin(), m_scratch.end());
+				else m_out.insert(m_out.end(), bytes, bytes + size);
+				m_out.resize(padded(m_out.size()));
+			}
+
+			void begin_pool(std::string_view name) {
+				m_pool_name = name;
+				m_pool_header = k_no_pool;
+			}
+
+			void end_pool() {
+				if (m_pool_header == k_no_pool) return;   // Nothing saved: the pool is left out
+				std::memcpy(m_out.data() + m_pool_header + 2 * sizeof(std::uint32_t), &m_columns, sizeof(m_columns));
+				++m_pool_count;
+			}
+
+			std::uint32_t row(std::size_t slot) const override {
+				return slot < m_slot_rows.size() ? m_slot_rows[slot] : none;
+			}
+
+			void rows(std::span<const std::uint32_t> rows) override {
+				m_pool_header = m_out.size();
+				m_pool_size = rows.size();
+				m_columns = 0;
+				put(static_cast<std::uint32_t>(m_pool_name.size()));
+				put(static_cast<std::uint32_t>(rows.size()));
+				put(std::uint32_t{ 0 });   // Column count, patched by end_pool()
+				put(std::uint32_t{ 0 });
+				put_name(m_pool_name);
+				put_block(rows.data(), rows.size_bytes());
+			}
+
+			void column(std::string_view name, ColumnKind kind, std::uint32_t width, const void* data) override {
+				put(static_cast<std::uint32_t>(name.size()));
+				put(static_cast<std::uint8_t>(kind));
+				put(std::uint8_t{ 0 });
+				put(static_cast<std::uint16_t>(width));
+				put_name(name);
+				put_block(data, m_pool_size * width);
+				++m_columns;
+			}
+
+			std::uint32_t intern(std::string_view text) override {
+				auto [it, added] = m_string_index.try_emplace(std::string(text), static_cast<std::uint32_t>(m_strings.size()));
+				if (added) m_strings.push_back(&it->first);
+				return it->second;
+			}
+
+			// Header, then the pools written so far, then the string table
+			std::vector<std::byte> finish(std::uint32_t entity_count) {
+				std::vector<std::byte> table;
+				auto append = [&](const void* p, std::size_t n) { table.insert(table.end(), static_cast<const std::byte*>(p), static_cast<const std::byte*>(p) + n); };
+
+				std::uint32_t offset = 0;
+				for (const std::string* s : m_strings) {
+					append(&offset, sizeof(offset));
+					offset += static_cast<std::uint32_t>(s->size() + 1);
+				}
+				append(&offset, sizeof(offset));
+				for (const std::string* s : m_strings) append(s->c_str(), s->size() + 1);
+				put_block(table.data(), table.size());
+
+				std::vector<std::byte> file;
+				file.reserve(32 + m_out.size());
+				file.insert(file.end(), reinterpret_cast<const std::byte*>(k_magic), reinterpret_cast<const std::byte*>(k_magic) + sizeof(k_magic));
+				const std::uint32_t header[4] = { k_binary_version, entity_count, m_pool_count, static_cast<std::uint32_t>(m_strings.size()) };
+				file.insert(file.end(), reinterpret_cast<const std::byte*>(header), reinterpret_cast<const std::byte*>(header) + sizeof(header));
+				file.resize(padded(file.size()));
+				file.insert(file.end(), m_out.begin(), m_out.end());
+				return file;
+			}
+
+		private:
+			static constexpr std::size_t k_no_pool = ~std::size_t{ 0 };
+
+			std::vector<std::uint32_t> m_slot_rows;    // TransformComponent slot -> file row
+			bool m_compress;
+
+			std::vector<std::byte> m_out;              // Pools
+			std::vector<std::byte> m_scratch;
+			std::uint32_t m_pool_count = 0;
+
+			std::string_view m_pool_name;
+			std::size_t m_pool_header = k_no_pool;
+			std::size_t m_pool_size = 0;
+			std::uint32_t m_columns = 0;
+
+			std::unordered_map<std::string, std::uint32_t> m_string_index;
+			std::vector<const std::string*> m_strings; // Index order (node keys stay put)
+		};
+
+		// ---------------- reading ----------------
+
+		// Read-only view of a whole file: memory-mapped, or read into memory if mapping fails
+		class MappedFile {
+		public:
+			explicit MappedFile(const std::filesystem::path& path) {
+#if defined(_WIN32)
+				m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+				LARGE_INTEGER size{};
+				if (m_file != INVALID_HANDLE_VALUE && GetFileSizeEx(m_file, &size) && size.QuadPart > 0) {
+					m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+					if (m_mapping) m_view = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+					if (m_view) {
+						m_data = static_cast<const std::byte*>(m_view);
+						m_size = static_cast<std::size_t>(size.QuadPart);
+						return;
+					}
+				}
+#else
+				m_fd = ::open(path.c_str(), O_RDONLY);
+				struct stat st {};
+				if (m_fd >= 0 && ::fstat(m_fd, &st) == 0 && st.st_size > 0) {
+					void* view = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, m_fd, 0);
+					if (view != MAP_FAILED) {
+						m_view = view;
+						m_data = static_cast<const std::byte*>(view);
+						m_size = static_cast<std::size_t>(st.st_size);
+						return;
+					}
+				}
+#endif
+				std::ifstream ifs(path, std::ios::binary);
+				if (!ifs) return;
+				m_copy.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+				m_data = reinterpret_cast<const std::byte*>(m_copy.data());
+				m_size = m_copy.size();
+				m_opened = true;
+			}
+
+			~MappedFile() {
+#if defined(_WIN32)
+				if (m_view) UnmapViewOfFile(m_view);
+				if (m_mapping) CloseHandle(m_mapping);
+				if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+#else
+				if (m_view) ::munmap(m_view, m_size);
+				if (m_fd >= 0) ::close(m_fd);
+#endif
+			}
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+
+			bool is_open() const { return m_view != nullptr || m_opened; }
+			const std::byte* data() const { return m_data; }
+			std::size_t size() const { return m_size; }
+
+		private:
+#if defined(_WIN32)
+			HANDLE m_file = INVALID_HANDLE_VALUE;
+			HANDLE m_mapping = nullptr;
+#else
+			int m_fd = -1;
+#endif
+			void* m_view = nullptr;
+			std::vector<char> m_copy;
+			bool m_opened = false;
+			const std::byte* m_data = nullptr;
+			std::size_t m_size = 0;
+		};
+
+		// Bounds-checked walk over the file. Raw blocks point into the mapping, LZ blocks into `decoded`.
+		class Cursor {
+		public:
+			Cursor(const std::byte* data, std::size_t size) : m_data(data), m_size(size) {}
+
+			template <typename T>
+			bool get(T& v) {
+				if (sizeof(T) > m_size - m_pos) return false;
+				std::memcpy(&v, m_data + m_pos, sizeof(T));
+				m_pos += sizeof(T);
+				return true;
+			}
+
+			bool name(std::uint32_t length, std::string_view& out) {
+				if (length > m_size - m_pos) return false;
+				out = std::string_view(reinterpret_cast<const char*>(m_data + m_pos), length);
+				return skip(padded(length));
+			}
+
+			bool block(const std::byte*& out, std::size_t expected, std::vector<std::unique_ptr<std::byte[]>>& decoded) {
+				std::uint32_t raw = 0, stored = 0, codec = 0, reserved = 0;
+				if (!get(raw) || !get(stored) || !get(codec) || !get(reserved)) return false;
+				if (raw != expected || stored > m_size - m_pos) return false;
+
+				const std::byte* bytes = m_data + m_pos;
+				if (codec == k_codec_raw) {
+					if (stored != raw) return false;
+					out = bytes;
+				} else if (codec == k_codec_lz) {
+					// A sequence spends at least one byte per 255 it outputs; anything larger is corrupt
+					if (raw > std::size_t{ stored } * 255 + 16) return false;
+					auto buffer = std::make_unique<std::byte[]>(raw ? raw : 1);
+					if (!lz::internal_decompress(bytes, stored, buffer.get(), raw)) return false;
+					out = buffer.get();
+					decoded.push_back(std::move(buffer));
+				} else {
+					return false;
+				}
+				return skip(padded(stored));
+			}
+
+			// A block whose size is only known from its header
+			bool block_any(const std::byte*& out, std::size_t& size, std::vector<std::unique_ptr<std::byte[]>>& decoded) {
+				std::uint32_t raw = 0;
+				if (sizeof(raw) > m_size - m_pos) return false;
+				std::memcpy(&raw, m_data + m_pos, sizeof(raw));
+				size = raw;
+				return block(out, raw, decoded);
+			}
+
+			std::size_t remaining() const { return m_size - m_pos; }
+
+		private:
+			bool skip(std::size_t n) {
+				if (n > m_size - m_pos) return false;
+				m_pos += n;
+				return true;
+			}
+
+			const std::byte* m_data;
+			std::size_t m_size;
+			std::size_t m_pos = 0;
+		};
+
+		struct ColumnView {
+			std::string_view name;
+			ColumnKind kind;
+			std::uint32_t width;
+			const std::byte* data;
+		};
+
+		struct PoolView {
+			std::string_view name;
+			const std::uint32_t* rows;    // Unaligned when read in place: read with memcpy
+			std::size_t count;
+			std::vector<ColumnView> columns;
+		};
+
+		class Reader final : public serialize::detail::PoolReader {
+		public:
+			Reader(const PoolView& pool, std::span<const me::entity::entity_id> entities, const std::vector<const char*>& strings)
+				: m_pool(pool), m_strings(strings) {
+				m_entities.resize(pool.count);
+				const auto* rows = reinterpret_cast<const std::byte*>(pool.rows);
+				for (std::size_t i = 0; i < pool.count; ++i) {
+					std::uint32_t row;
+					std::memcpy(&row, rows + i * sizeof(row), sizeof(row));
+					m_entities[i] = entities[row];
+				}
+			}
+
+			std::span<const me::entity::entity_id> entities() const override { return m_entities; }
+
+			const std::byte* column(std::string_view name, ColumnKind kind, std::uint32_t width) const override {
+				for (const auto& c : m_pool.columns)
+					if (c.name == name) return c.kind == kind && c.width == width ? c.data : nullptr;
+				return nullptr;
+			}
+
+			const char* string(std::uint32_t index) const override {
+				return index < m_strings.size() ? m_strings[index] : "";
+			}
+
+		private:
+			const PoolView& m_pool;
+			const std::vector<const char*>& m_strings;
+			std::vector<me::entity::entity_id> m_entities;
+		};
+	} // namespace
+
+	bool save_binary(const std::filesystem::path& path, const BinaryOptions& options) {
+		ME_PROFILE_SCOPE("scene_file::save_binary");
+		const auto start = std::chrono::steady_clock::now();
+		auto& reg = me::get_registry();
+		auto& transforms = reg.view<TransformComponent>();
+
+		// Live entities with a transform get consecutive rows
+		std::vector<std::uint32_t> slot_rows(transforms.size(), k_none);
+		std::unordered_map<me::entity::entity_id, std::uint32_t> entity_rows;
+		std::uint32_t entity_count = 0;
+		for (std::size_t i = 0; i < transforms.size(); ++i) {
+			if (!reg.is_alive(transforms.entity_map[i])) continue;
+			entity_rows.emplace(transforms.entity_map[i], entity_count);
+			slot_rows[i] = entity_count++;
+		}
+
+		Writer out(std::move(slot_rows), options.compress);
+		for (const auto& ops : serialize::components()) {
+			out.begin_pool(ops.name);
+			ops.save_binary(reg, out);
+			out.end_pool();
+		}
+
+		// Parents by row; links to entities that aren't saved are dropped
+		std::vector<std::uint32_t> children, parents;
+		const TransformComponent* base = transforms.components.data();
+		for (auto [e, t, p] : me::view<TransformComponent, ParentComponent>(reg)) {
+			const std::uint32_t child = out.row(static_cast<std::size_t>(&t - base));
+			auto it = entity_rows.find(p.parent);
+			if (child == k_none || p.parent == ParentComponent::none || it == entity_rows.end()) continue;
+			children.push_back(child);
+			parents.push_back(it->second);
+		}
+		if (!children.empty()) {
+			out.begin_pool(reflect::name_of<ParentComponent>);
+			out.rows(children);
+			out.column("id", ColumnKind::Unsigned, sizeof(std::uint32_t), parents.data());
+			out.end_pool();
+		}
+
+		const std::vector<std::byte> file = out.finish(entity_count);
+		std::ofstream ofs(path, std::ios::binary);
+		if (!ofs) return false;
+		ofs.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+		if (!ofs) return false;
+
+		internal_record_save({ entity_count, file.size(), internal_seconds_since(start), true });
+		return true;
+	}
+
+	bool internal_load_binary(const std::filesystem::path& path, std::vector<me::entity::entity_id>* created) {
+		ME_PROFILE_SCOPE("scene_file::load_binary");
+		const auto start = std::chrono::steady_clock::now();
+		MappedFile file(path);
+		if (!file.is_open()) return false;
+
+		// Validate and index everything before touching the registry
+		Cursor in(file.data(), file.size());
+		char magic[8] = {};
+		std::uint32_t version = 0, entity_count = 0, pool_count = 0, string_count = 0;
+		if (!in.get(magic) || std::memcmp(magic, k_magic, sizeof(k_magic)) != 0) return false;
+		if (!in.get(version) || version != k_binary_version) return false;
+		if (!in.get(entity_count) || !in.get(pool_count) || !in.get(string_count)) return false;
+
+		// Counts are checked against what the file could hold before anything is allocated for them
+		constexpr std::size_t k_pool_header = 4 * sizeof(std::uint32_t);
+		constexpr std::size_t k_column_header = 2 * sizeof(std::uint32_t);
+		if (pool_count > in.remaining() / k_pool_header) return false;
+
+		std::vector<std::unique_ptr<std::byte[]>> decoded;
+		std::vector<PoolView> pools(pool_count);
+		std::size_t largest_pool = 0;
+		for (auto& pool : pools) {
+			std::uint32_t name_length = 0, count = 0, column_count = 0, reserved = 0;
+			if (!in.get(name_length) || !in.get(count) || !in.get(column_count) || !in.get(reserved)) return false;
+			if (!in.name(name_length, pool.name)) return false;
+
+			const std::byte* rows = nullptr;
+			if (!in.block(rows, std::size_t{ count } * sizeof(std::uint32_t), decoded)) return false;
+			for (std::uint32_t i = 0; i < count; ++i) {
+				std::uint32_t row;
+				std::memcpy(&row, rows + i * sizeof(row), sizeof(row));
+				if (row >= entity_count) return false;
+			}
+			pool.rows = reinterpret_cast<const std::uint32_t*>(rows);
+			pool.count = count;
+			largest_pool = std::max<std::size_t>(largest_pool, count);
+
+			if (column_count > in.remaining() / k_column_header) return false;
+			pool.columns.resize(column_count);
+			for (auto& column : pool.columns) {
+				std::uint8_t kind = 0, reserved8 = 0;
+				std::uint16_t width = 0;
+				if (!in.get(name_length) || !in.get(kind) || !in.get(reserved8) || !in.get(width)) return false;
+				if (!in.name(name_length, column.name)) return false;
+				column.kind = static_cast<ColumnKind>(kind);
+				column.width = width;
+				if (!in.block(column.data, std::size_t{ count } * width, decoded)) return false;
+			}
+		}
+
+		const std::byte* table = nullptr;
+		std::size_t table_size = 0;
+		if (!in.block_any(table, table_size, decoded)) return false;
+		const std::size_t offsets_size = (std::size_t{ string_count } + 1) * sizeof(std::uint32_t);
+		if (offsets_size > table_size) return false;
+
+		std::vector<const char*> strings(string_count);
+		const char* chars = reinterpret_cast<const char*>(table + offsets_size);
+		const std::size_t chars_size = table_size - offsets_size;
+		for (std::uint32_t i = 0; i < string_count; ++i) {
+			std::uint32_t begin, end;
+			std::memcpy(&begin, table + i * sizeof(begin), sizeof(begin));
+			std::memcpy(&end, table + (i + 1) * sizeof(end), sizeof(end));
+			if (begin >= end || end > chars_size || chars[end - 1] != '\0') return false;
+			strings[i] = chars + begin;
+		}
+
+		// Every saved entity owns a transform, so some pool has a row for each
+		if (entity_count > largest_pool) return false;
+
+		// Apply: entities, then one bulk pass per pool
+		auto& reg = me::get_registry();
+		std::vector<me::entity::entity_id> entities(entity_count);
+		for (auto& e : entities) e = reg.create_entity("Entity");
+		if (created) created->insert(created->end(), entities.begin(), entities.end());
+
+		std::unordered_map<std::string_view, const serialize::detail::ComponentOps*> loaders;
+		for (const auto& ops : serialize::components()) loaders.emplace(ops.name, &ops);
+
+		for (const auto& pool : pools) {
+			Reader reader(pool, entities, strings);
+			if (pool.name == reflect::name_of<ParentComponent>) {
+				const std::byte* ids = reader.column("id", ColumnKind::Unsigned, sizeof(std::uint32_t));
+				if (!ids) continue;
+				const auto children = reader.entities();
+				for (std::size_t i = 0; i < children.size(); ++i) {
+					std::uint32_t parent;
+					std::memcpy(&parent, ids + i * sizeof(parent), sizeof(parent));
+					if (parent < entity_count) me::transform::set_parent(children[i], entities[parent]);
+				}
+			} else if (auto it = loaders.find(pool.name); it != loaders.end()) {
+				it->second->load_binary(reg, reader);
+			}
+		}
+
+		internal_record_load({ entity_count, file.size(), internal_seconds_since(start), true });
+		return true;
+	}
+
+	bool load_binary(const std::filesystem::path& path) {
+		return internal_load_binary(path, nullptr);
+	}
+
+} // namespace me::scene_file
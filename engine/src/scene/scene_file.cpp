@@ -0,0 +1,316 @@
+#include "mini-engine-raylib/scene/scene_file.hpp"
+#include "mini-engine-raylib/core/engine.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+#include "mini-engine-raylib/ecs/components.hpp"
+#include "mini-engine-raylib/ecs/reflect.hpp"
+#include "mini-engine-raylib/ecs/serialize.hpp"
+#include "mini-engine-raylib/ecs/transform_system.hpp"
+#include "scene_file_internal.hpp"
+
+#include <mini-ecs/registry.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace me::scene_file {
+
+	namespace {
+		using json = nlohmann::ordered_json;
+		using me::components::ParentComponent;
+		using me::components::TransformComponent;
+
+		constexpr std::size_t k_read_buffer = 256 * 1024;
+
+		Stats s_load_stats;
+		Stats s_save_stats;
+
+		bool is_binary(const std::filesystem::path& path) {
+			return path.extension() == k_binary_extension;
+		}
+	} // namespace
+
+	// ===================================================================
+	// JSON: {"entities":[{"id":N,"components":{"Transform":{...},"Parent":{"id":N}}}]}
+	// ===================================================================
+
+	bool save_json(const std::filesystem::path& path) {
+		ME_PROFILE_SCOPE("scene_file::save_json");
+		const auto start = std::chrono::steady_clock::now();
+		std::ofstream ofs(path, std::ios::binary);
+		if (!ofs) return false;
+
+		auto& reg = me::get_registry();
+		auto& transforms = reg.view<TransformComponent>();
+		std::size_t count = 0;
+		{
+			serialize::JsonWriter out(ofs);
+			out.begin_object();
+			out.key("entities");
+			out.begin_array();
+			for (std::size_t i = 0; i < transforms.size(); ++i) {
+				const me::entity::entity_id e = transforms.entity_map[i];
+				if (!reg.is_alive(e)) continue;
+
+				out.begin_object();
+				out.key("id");
+				serialize::write_json(out, static_cast<std::uint32_t>(e));
+				out.key("components");
+				out.begin_object();
+				for (const auto& ops : serialize::components()) ops.write_json(out, reg, e);
+				if (const auto* p = reg.try_get_component<ParentComponent>(e); p && p->parent != ParentComponent::none) {
+					out.key(reflect::name_of<ParentComponent>);
+					serialize::write_json(out, *p);
+				}
+				out.end_object();
+				out.end_object();
+				++count;
+			}
+			out.end_array();
+			out.end_object();
+		}
+		if (!ofs) return false;
+
+		internal_record_save({ count, static_cast<std::size_t>(ofs.tellp()), internal_seconds_since(start), false });
+		return true;
+	}
+
+	namespace {
+		// Creates each entity when its object opens and adds each component when its value closes. Only the value
+		// of one component is ever held as a document; everything else is skipped token by token.
+		class SaxLoader final : public nlohmann::json_sax<json> {
+		public:
+			explicit SaxLoader(Registry& reg) : m_reg(reg) {
+				for (const auto& ops : serialize::components()) m_loaders.emplace(ops.name, &ops);
+			}
+
+			bool null() override { return scalar(nullptr); }
+			bool boolean(bool v) override { return scalar(v); }
+			bool number_integer(number_integer_t v) override { return scalar(v); }
+			bool number_unsigned(number_unsigned_t v) override { return scalar(v); }
+			bool number_float(number_float_t v, const string_t&) override { return scalar(v); }
+			bool string(string_t& v) override { return scalar(std::move(v)); }
+			bool binary(binary_t&) override { return true; }   // Never produced by the text parser
+
+			bool key(string_t& k) override {
+				m_key.assign(k);
+				return true;
+			}
+
+			bool start_object(std::size_t) override {
+				if (!m_stack.empty()) return nest(json::object());
+
+				Scope scope = Scope::Skip;
+				if (m_scopes.empty()) {
+					scope = Scope::Root;
+				} else if (m_scopes.back() == Scope::Entities) {
+					scope = Scope::Entity;
+					m_entity = m_reg.create_entity("Entity");
+					m_created.push_back(m_entity);
+				} else if (m_scopes.back() == Scope::Entity && m_key == "components") {
+					scope = Scope::Components;
+				} else if (m_scopes.back() == Scope::Components) {
+					return collect(json::object());
+				}
+				m_scopes.push_back(scope);
+				return true;
+			}
+
+			bool start_array(std::size_t) override {
+				if (!m_stack.empty()) return nest(json::array());
+
+				Scope scope = Scope::Skip;
+				if (!m_scopes.empty() && m_scopes.back() == Scope::Root && m_key == "entities") {
+					scope = Scope::Entities;
+				} else if (!m_scopes.empty() && m_scopes.back() == Scope::Components) {
+					return collect(json::array());
+				}
+				m_scopes.push_back(scope);
+				return true;
+			}
+
+			bool end_object() override { return end(); }
+			bool end_array() override { return end(); }
+
+			bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception&) override { return false; }
+
+			// Links parents once every saved id is known; returns the entities created
+			std::vector<me::entity::entity_id> finish() {
+				for (const auto& [child, saved_parent] : m_parents) {
+					if (auto it = m_ids.find(saved_parent); it != m_ids.end())
+						me::transform::set_parent(child, it->second);
+				}
+				return std::move(m_created);
+			}
+
+			void abort() {
+				for (me::entity::entity_id e : m_created) m_reg.destroy_entity(e);
+				m_created.clear();
+			}
+
+		private:
+			enum class Scope : std::uint8_t { Root, Entities, Entity, Components, Skip };
+
+			template <typename V>
+			bool scalar(V&& v) {
+				if (!m_stack.empty()) {
+					place(json(std::forward<V>(v)));
+				} else if (!m_scopes.empty() && m_scopes.back() == Scope::Components) {
+					m_component = m_key;
+					m_value = json(std::forward<V>(v));
+					add_component();
+				} else if (!m_scopes.empty() && m_scopes.back() == Scope::Entity && m_key == "id") {
+					if constexpr (std::is_arithmetic_v<std::remove_cvref_t<V>> && !std::is_same_v<std::remove_cvref_t<V>, bool>)
+						m_ids[static_cast<std::uint32_t>(v)] = m_entity;
+				}
+				return true;
+			}
+
+			// First container of a component value: collected into m_value until it closes
+			bool collect(json&& container) {
+				m_component = m_key;
+				m_value = std::move(container);
+				m_stack.push_back(&m_value);
+				return true;
+			}
+
+			bool nest(json&& container) {
+				m_stack.push_back(place(std::move(container)));
+				return true;
+			}
+
+			json* place(json&& v) {
+				json& parent = *m_stack.back();
+				if (parent.is_array()) {
+					parent.push_back(std::move(v));
+					return &parent.back();
+				}
+				json& slot = parent[m_key];
+				slot = std::move(v);
+				return &slot;
+			}
+
+			bool end() {
+				if (!m_stack.empty()) {
+					m_stack.pop_back();
+					if (m_stack.empty()) add_component();
+					return true;
+				}
+				m_scopes.pop_back();
+				return true;
+			}
+
+			// Unknown component names are skipped
+			void add_component() {
+				if (m_component == reflect::name_of<ParentComponent>) {
+					ParentComponent p{ 0 };
+					serialize::from_json(m_value, p);
+					m_parents.emplace_back(m_entity, static_cast<std::uint32_t>(p.parent));
+				} else if (auto it = m_loaders.find(m_component); it != m_loaders.end()) {
+					it->second->load_json(m_reg, m_entity, m_value);
+				}
+			}
+
+			Registry& m_reg;
+			std::unordered_map<std::string_view, const serialize::detail::ComponentOps*> m_loaders;
+
+			std::vector<Scope> m_scopes;
+			std::string m_key;
+			me::entity::entity_id m_entity{};
+
+			// Component value being collected, and its name
+			std::string m_component;
+			json m_value;
+			std::vector<json*> m_stack;
+
+			// Saved ids -> new entities, so parents can be linked once everything exists
+			std::unordered_map<std::uint32_t, me::entity::entity_id> m_ids;
+			std::vector<std::pair<me::entity::entity_id, std::uint32_t>> m_parents;
+			std::vector<me::entity::entity_id> m_created;
+		};
+	} // namespace
+
+	bool internal_load_json(const std::filesystem::path& path, std::vector<me::entity::entity_id>* created) {
+		ME_PROFILE_SCOPE("scene_file::load_json");
+		const auto start = std::chrono::steady_clock::now();
+		// Declared before the stream, which points into it until destroyed
+		std::vector<char> buffer(k_read_buffer);
+		std::ifstream ifs;
+
+		// Best effort: libstdc++ only takes the buffer before open(), MSVC only after it (before any read), so it's
+		// offered both times. Other libraries may keep their default buffer.
+		ifs.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+		ifs.open(path, std::ios::binary);
+		if (!ifs) return false;
+		ifs.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+		// A parse error leaves nothing behind
+		SaxLoader loader(me::get_registry());
+		bool parsed = false;
+		try { parsed = json::sax_parse(ifs, &loader); } catch (...) {}
+		if (!parsed) {
+			loader.abort();
+			return false;
+		}
+
+		const std::vector<me::entity::entity_id> entities = loader.finish();
+		if (created) created->insert(created->end(), entities.begin(), entities.end());
+
+		std::error_code ec;
+		const auto bytes = std::filesystem::file_size(path, ec);
+		internal_record_load({ entities.size(), ec ? 0 : static_cast<std::size_t>(bytes), internal_seconds_since(start), false });
+		return true;
+	}
+
+	bool load_json(const std::filesystem::path& path) {
+		return internal_load_json(path, nullptr);
+	}
+
+	// ===================================================================
+	// STATS
+	// ===================================================================
+
+	void internal_record_load(const Stats& stats) {
+		s_load_stats = stats;
+		ME_PROFILE_COUNTER("scene_file::entities_per_sec", stats.entities_per_second());
+	}
+
+	void internal_record_save(const Stats& stats) {
+		s_save_stats = stats;
+	}
+
+	Stats load_stats() { return s_load_stats; }
+	Stats save_stats() { return s_save_stats; }
+
+	// ===================================================================
+	// FORMAT DISPATCH / CONVERSION
+	// ===================================================================
+
+	bool save(const std::filesystem::path& path, const BinaryOptions& options) {
+		return is_binary(path) ? save_binary(path, options) : save_json(path);
+	}
+
+	bool load(const std::filesystem::path& path) {
+		return is_binary(path) ? load_binary(path) : load_json(path);
+	}
+
+	bool convert(const std::filesystem::path& in, const std::filesystem::path& out, const BinaryOptions& options) {
+		std::vector<me::entity::entity_id> created;
+		const bool loaded = is_binary(in) ? internal_load_binary(in, &created) : internal_load_json(in, &created);
+		const bool saved = loaded && save(out, options);
+
+		auto& reg = me::get_registry();
+		for (me::entity::entity_id e : created) reg.destroy_entity(e);
+		return saved;
+	}
+
+} // namespace me::scene_file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "mini-engine-raylib/scene/scene_file.hpp"
+
+#include <mini-ecs/entity.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+namespace me::scene_file {
+
+	// Internal-only: load into the engine registry and append every entity created to `created` (may be null)
+	bool internal_load_json(const std::filesystem::path& path, std::vector<me::entity::entity_id>* created);
+	bool internal_load_binary(const std::filesystem::path& path, std::vector<me::entity::entity_id>* created);
+
+	inline double internal_seconds_since(std::chrono::steady_clock::time_point start) {
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Records load_stats()/save_stats() and the matching profiler counter
+	void internal_record_load(const Stats& stats);
+	void internal_record_save(const Stats& stats);
+
+} // namespace me::scene_file
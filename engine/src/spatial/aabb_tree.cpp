@@ -0,0 +1,316 @@
+#include "aabb_tree.hpp"
+
+#include <algorithm>
+
+namespace me::spatial {
+
+	namespace {
+		float axis(const me::math::Vec3& v, int a) {
+			return a == 0 ? v.x : (a == 1 ? v.y : v.z);
+		}
+
+		// Twice the center along an axis, only compared
+		float center(const Aabb& box, int a) {
+			return axis(box.min, a) + axis(box.max, a);
+		}
+	} // namespace
+
+	std::int32_t AabbTree::allocate() {
+		if (m_free == null) {
+			m_nodes.emplace_back();
+			return static_cast<std::int32_t>(m_nodes.size() - 1);
+		}
+
+		const std::int32_t index = m_free;
+		m_free = m_nodes[index].parent;
+		--m_free_count;
+		m_nodes[index] = Node{};
+		return index;
+	}
+
+	void AabbTree::release(std::int32_t index) {
+		m_nodes[index].parent = m_free;
+		m_nodes[index].height = -1;
+		m_free = index;
+		++m_free_count;
+	}
+
+	std::int32_t AabbTree::insert(me::entity::entity_id entity, const Aabb& tight, const Aabb& fat) {
+		const std::int32_t leaf = allocate();
+		Node& node = m_nodes[leaf];
+		node.box = fat;
+		node.tight = tight;
+		node.entity = entity;
+		insert_leaf(leaf);
+		++m_leaves;
+		return leaf;
+	}
+
+	void AabbTree::remove(std::int32_t leaf) {
+		remove_leaf(leaf);
+		release(leaf);
+		--m_leaves;
+	}
+
+	void AabbTree::move(std::int32_t leaf, const Aabb& tight, const Aabb& fat) {
+		remove_leaf(leaf);
+		m_nodes[leaf].box = fat;
+		m_nodes[leaf].tight = tight;
+		insert_leaf(leaf);
+	}
+
+	std::int32_t AabbTree::insert_deferred(me::entity::entity_id entity, const Aabb& tight, const Aabb& fat) {
+		const std::int32_t leaf = allocate();
+		Node& node = m_nodes[leaf];
+		node.box = fat;
+		node.tight = tight;
+		node.entity = entity;
+		++m_leaves;
+		return leaf;
+	}
+
+	void AabbTree::move_deferred(std::int32_t leaf, const Aabb& tight, const Aabb& fat) {
+		m_nodes[leaf].box = fat;
+		m_nodes[leaf].tight = tight;
+	}
+
+	void AabbTree::clear() {
+		m_nodes.clear();
+		m_root = null;
+		m_free = null;
+		m_free_count = 0;
+		m_leaves = 0;
+	}
+
+	void AabbTree::insert_leaf(std::int32_t leaf) {
+		if (m_root == null) {
+			m_root = leaf;
+			m_nodes[leaf].parent = null;
+			return;
+		}
+
+		// 1. Walk down to the cheapest sibling: the cost of a new parent there vs. pushing further down
+		const Aabb box = m_nodes[leaf].box;
+		std::int32_t index = m_root;
+		while (!m_nodes[index].is_leaf()) {
+			const Node& node = m_nodes[index];
+			const float area = internal_area(node.box);
+			const float combined = internal_area(internal_merge(node.box, box));
+
+			const float cost = 2.0f * combined;
+			const float inherited = 2.0f * (combined - area);
+
+			auto descend_cost = [&](std::int32_t child) {
+				const Node& c = m_nodes[child];
+				const float merged = internal_area(internal_merge(box, c.box));
+				return (c.is_leaf() ? merged : merged - internal_area(c.box)) + inherited;
+			};
+			const float left_cost = descend_cost(node.left);
+			const float right_cost = descend_cost(node.right);
+
+			if (cost < left_cost && cost < right_cost) break;
+			index = left_cost < right_cost ? node.left : node.right;
+		}
+
+		// 2. New parent for the sibling and the leaf
+		const std::int32_t sibling = index;
+		const std::int32_t old_parent = m_nodes[sibling].parent;
+		const std::int32_t new_parent = allocate();
+
+		Node& parent = m_nodes[new_parent];
+		parent.parent = old_parent;
+		parent.box = internal_merge(box, m_nodes[sibling].box);
+		parent.height = m_nodes[sibling].height + 1;
+		parent.left = sibling;
+		parent.right = leaf;
+
+		if (old_parent == null) m_root = new_parent;
+		else if (m_nodes[old_parent].left == sibling) m_nodes[old_parent].left = new_parent;
+		else m_nodes[old_parent].right = new_parent;
+
+		m_nodes[sibling].parent = new_parent;
+		m_nodes[leaf].parent = new_parent;
+
+		// 3. Fix boxes and heights on the way up
+		refit_up(new_parent);
+	}
+
+	void AabbTree::remove_leaf(std::int32_t leaf) {
+		if (leaf == m_root) {
+			m_root = null;
+			return;
+		}
+
+		const std::int32_t parent = m_nodes[leaf].parent;
+		const std::int32_t grandparent = m_nodes[parent].parent;
+		const std::int32_t sibling = m_nodes[parent].left == leaf ? m_nodes[parent].right : m_nodes[parent].left;
+
+		// The sibling takes the parent's place
+		m_nodes[sibling].parent = grandparent;
+		release(parent);
+
+		if (grandparent == null) {
+			m_root = sibling;
+			return;
+		}
+
+		if (m_nodes[grandparent].left == parent) m_nodes[grandparent].left = sibling;
+		else m_nodes[grandparent].right = sibling;
+		refit_up(grandparent);
+	}
+
+	void AabbTree::refit_up(std::int32_t index) {
+		while (index != null) {
+			index = balance(index);
+
+			Node& node = m_nodes[index];
+			const Node& left = m_nodes[node.left];
+			const Node& right = m_nodes[node.right];
+			node.height = 1 + std::max(left.height, right.height);
+			node.box = internal_merge(left.box, right.box);
+
+			index = node.parent;
+		}
+	}
+
+	// Rotates the taller grandchild up when a's children differ in height by more than one. Returns a's replacement.
+	std::int32_t AabbTree::balance(std::int32_t ia) {
+		Node& a = m_nodes[ia];
+		if (a.is_leaf() || a.height < 2) return ia;
+
+		const std::int32_t ib = a.left;
+		const std::int32_t ic = a.right;
+		Node& b = m_nodes[ib];
+		Node& c = m_nodes[ic];
+		const std::int32_t skew = c.height - b.height;
+
+		auto replace_child = [&](std::int32_t parent, std::int32_t from, std::int32_t to) {
+			if (parent == null) m_root = to;
+			else if (m_nodes[parent].left == from) m_nodes[parent].left = to;
+			else m_nodes[parent].right = to;
+		};
+
+		// Right side taller: c goes up
+		if (skew > 1) {
+			const std::int32_t if_ = c.left;
+			const std::int32_t ig = c.right;
+			Node& f = m_nodes[if_];
+			Node& g = m_nodes[ig];
+
+			c.left = ia;
+			c.parent = a.parent;
+			a.parent = ic;
+			replace_child(c.parent, ia, ic);
+
+			if (f.height > g.height) {
+				c.right = if_;
+				a.right = ig;
+				g.parent = ia;
+				a.box = internal_merge(b.box, g.box);
+				c.box = internal_merge(a.box, f.box);
+				a.height = 1 + std::max(b.height, g.height);
+				c.height = 1 + std::max(a.height, f.height);
+			} else {
+				c.right = ig;
+				a.right = if_;
+				f.parent = ia;
+				a.box = internal_merge(b.box, f.box);
+				c.box = internal_merge(a.box, g.box);
+				a.height = 1 + std::max(b.height, f.height);
+				c.height = 1 + std::max(a.height, g.height);
+			}
+			return ic;
+		}
+
+		// Left side taller: b goes up
+		if (skew < -1) {
+			const std::int32_t id = b.left;
+			const std::int32_t ie = b.right;
+			Node& d = m_nodes[id];
+			Node& e = m_nodes[ie];
+
+			b.left = ia;
+			b.parent = a.parent;
+			a.parent = ib;
+			replace_child(b.parent, ia, ib);
+
+			if (d.height > e.height) {
+				b.right = id;
+				a.left = ie;
+				e.parent = ia;
+				a.box = internal_merge(c.box, e.box);
+				b.box = internal_merge(a.box, d.box);
+				a.height = 1 + std::max(c.height, e.height);
+				b.height = 1 + std::max(a.height, d.height);
+			} else {
+				b.right = ie;
+				a.left = id;
+				d.parent = ia;
+				a.box = internal_merge(c.box, d.box);
+				b.box = internal_merge(a.box, e.box);
+				a.height = 1 + std::max(c.height, d.height);
+				b.height = 1 + std::max(a.height, e.height);
+			}
+			return ib;
+		}
+
+		return ia;
+	}
+
+	void AabbTree::rebuild() {
+		std::vector<std::int32_t> leaves;
+		leaves.reserve(m_leaves);
+
+		// Keep the leaves (their indices are handles), free every internal node
+		m_free = null;
+		m_free_count = 0;
+		for (std::size_t i = m_nodes.size(); i-- > 0;) {
+			const std::int32_t index = static_cast<std::int32_t>(i);
+			if (m_nodes[i].height == 0) leaves.push_back(index);
+			else release(index);
+		}
+
+		m_root = leaves.empty() ? null : build(leaves.data(), leaves.size());
+	}
+
+	// Top-down: split at the median along the longest axis of the leaf centers
+	std::int32_t AabbTree::build(std::int32_t* leaves, std::size_t count) {
+		if (count == 1) {
+			m_nodes[leaves[0]].parent = null;
+			return leaves[0];
+		}
+
+		float lo[3], hi[3];
+		for (int a = 0; a < 3; ++a) lo[a] = hi[a] = center(m_nodes[leaves[0]].box, a);
+		for (std::size_t i = 1; i < count; ++i) {
+			for (int a = 0; a < 3; ++a) {
+				const float c = center(m_nodes[leaves[i]].box, a);
+				lo[a] = std::min(lo[a], c);
+				hi[a] = std::max(hi[a], c);
+			}
+		}
+
+		int split = 0;
+		for (int a = 1; a < 3; ++a)
+			if (hi[a] - lo[a] > hi[split] - lo[split]) split = a;
+
+		const std::size_t mid = count / 2;
+		std::nth_element(leaves, leaves + mid, leaves + count, [&](std::int32_t x, std::int32_t y) {
+			return center(m_nodes[x].box, split) < center(m_nodes[y].box, split);
+		});
+
+		const std::int32_t left = build(leaves, mid);
+		const std::int32_t right = build(leaves + mid, count - mid);
+
+		const std::int32_t index = allocate();
+		Node& node = m_nodes[index];
+		node.left = left;
+		node.right = right;
+		node.height = 1 + std::max(m_nodes[left].height, m_nodes[right].height);
+		node.box = internal_merge(m_nodes[left].box, m_nodes[right].box);
+		m_nodes[left].parent = index;
+		m_nodes[right].parent = index;
+		return index;
+	}
+
+} // namespace me::spatial
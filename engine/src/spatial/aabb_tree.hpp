@@ -0,0 +1,93 @@
+#pragma once
+
+#include "mini-engine-raylib/spatial/spatial.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace me::spatial {
+
+	// Dynamic AABB tree (as in Box2D): leaves hold a fattened box so small moves need no update, inserts pick the
+	// sibling with the lowest surface cost and AVL rotations keep it balanced. rebuild() does a top-down median
+	// split instead, cheaper when most leaves moved. Not thread-safe; spatial.cpp guards it.
+	class AabbTree {
+	public:
+		static constexpr std::int32_t null = -1;
+
+		struct Node {
+			Aabb box;                        // Leaves: fattened bounds
+			Aabb tight;                      // Leaves: actual bounds
+			std::int32_t parent = null;      // Also the free list link
+			std::int32_t left = null;
+			std::int32_t right = null;
+			std::int32_t height = 0;         // Leaves are 0, free nodes -1
+			me::entity::entity_id entity = 0;
+			std::uint32_t stamp = 0;         // Last update that saw this leaf
+
+			bool is_leaf() const { return left == null; }
+		};
+
+		// Returns the leaf index (stable until remove)
+		std::int32_t insert(me::entity::entity_id entity, const Aabb& tight, const Aabb& fat);
+		void remove(std::int32_t leaf);
+
+		// Re-inserts a leaf whose bounds left its fat box
+		void move(std::int32_t leaf, const Aabb& tight, const Aabb& fat);
+
+		// Batch path: add or update leaves without touching the tree, then rebuild() once.
+		// The tree must not be queried or changed in between.
+		std::int32_t insert_deferred(me::entity::entity_id entity, const Aabb& tight, const Aabb& fat);
+		void move_deferred(std::int32_t leaf, const Aabb& tight, const Aabb& fat);
+
+		// Rebuilds every internal node from the current leaves
+		void rebuild();
+
+		void clear();
+
+		std::int32_t root() const { return m_root; }
+		std::span<const Node> nodes() const { return m_nodes; }
+		Node& leaf(std::int32_t index) { return m_nodes[index]; }
+
+		std::size_t leaf_count() const { return m_leaves; }
+		std::size_t node_count() const { return m_nodes.size() - m_free_count; }
+		int height() const { return m_root == null ? 0 : m_nodes[m_root].height; }
+
+	private:
+		std::int32_t allocate();
+		void release(std::int32_t index);
+
+		void insert_leaf(std::int32_t leaf);
+		void remove_leaf(std::int32_t leaf);
+		std::int32_t balance(std::int32_t a);
+		void refit_up(std::int32_t index);
+		std::int32_t build(std::int32_t* leaves, std::size_t count);
+
+		std::vector<Node> m_nodes;
+		std::int32_t m_root = null;
+		std::int32_t m_free = null;
+		std::size_t m_free_count = 0;
+		std::size_t m_leaves = 0;
+	};
+
+	inline Aabb internal_merge(const Aabb& a, const Aabb& b) {
+		return { { a.min.x < b.min.x ? a.min.x : b.min.x, a.min.y < b.min.y ? a.min.y : b.min.y, a.min.z < b.min.z ? a.min.z : b.min.z },
+			{ a.max.x > b.max.x ? a.max.x : b.max.x, a.max.y > b.max.y ? a.max.y : b.max.y, a.max.z > b.max.z ? a.max.z : b.max.z } };
+	}
+
+	inline bool internal_contains(const Aabb& outer, const Aabb& inner) {
+		return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+			inner.max.x <= outer.max.x && inner.max.y <= outer.max.y && inner.max.z <= outer.max.z;
+	}
+
+	inline bool internal_overlaps(const Aabb& a, const Aabb& b) {
+		return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y && a.min.z <= b.max.z && b.min.z <= a.max.z;
+	}
+
+	// Half the surface area, the insertion cost metric
+	inline float internal_area(const Aabb& a) {
+		const float x = a.max.x - a.min.x, y = a.max.y - a.min.y, z = a.max.z - a.min.z;
+		return x * y + y * z + z * x;
+	}
+
+} // namespace me::spatial
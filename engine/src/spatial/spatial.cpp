@@ -0,0 +1,392 @@
+#include "mini-engine-raylib/spatial/spatial.hpp"
+#include "aabb_tree.hpp"
+#include "spatial_internal.hpp"
+#include "../ecs/transform_internal.hpp"
+
+#include "mini-engine-raylib/core/engine.hpp"
+#include "mini-engine-raylib/core/frame_arena.hpp"
+#include "mini-engine-raylib/core/jobs.hpp"
+#include "mini-engine-raylib/core/profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace me::spatial {
+
+	namespace {
+		using me::components::TransformComponent;
+		using Node = AabbTree::Node;
+
+		// Transforms per bounds job
+		constexpr std::size_t k_bounds_grain = 4096;
+
+		// Fat box margin: absolute plus a fraction of the largest half extent
+		constexpr float k_margin = 0.1f;
+		constexpr float k_margin_scale = 0.1f;
+
+		// Rebuild instead of re-inserting when more than 1 / k_rebuild_ratio of the leaves changed
+		constexpr std::size_t k_rebuild_ratio = 4;
+		constexpr std::size_t k_rebuild_min = 64;
+
+		enum SlotState : std::uint8_t { Unchanged, Moved, Unknown };
+
+		std::shared_mutex s_mutex;          // Queries share it; update() holds it only while writing the tree
+		std::mutex s_update_mutex;          // One update() at a time
+		std::atomic<bool> s_active{ false };
+		const Registry* s_owner = nullptr;
+
+		AabbTree s_tree;
+		std::uint32_t s_stamp = 0;
+		Stats s_stats;
+
+		std::vector<std::int32_t> s_slot_leaf;                                 // Per TransformComponent pool slot, last known leaf
+		std::unordered_map<me::entity::entity_id, std::int32_t> s_leaves;      // Entity -> leaf
+
+		// Box of the unit primitive (-1..1) under a column-major world matrix
+		Aabb bounds(const float* m) {
+			const me::math::Vec3 c{ m[12], m[13], m[14] };
+			const me::math::Vec3 h{
+				std::fabs(m[0]) + std::fabs(m[4]) + std::fabs(m[8]),
+				std::fabs(m[1]) + std::fabs(m[5]) + std::fabs(m[9]),
+				std::fabs(m[2]) + std::fabs(m[6]) + std::fabs(m[10]),
+			};
+			return { c - h, c + h };
+		}
+
+		Aabb fatten(const Aabb& box) {
+			const float extent = std::max({ box.max.x - box.min.x, box.max.y - box.min.y, box.max.z - box.min.z });
+			const float margin = k_margin + k_margin_scale * 0.5f * extent;
+			const me::math::Vec3 m{ margin, margin, margin };
+			return { box.min - m, box.max + m };
+		}
+
+		// Squared distance from a point to a box, 0 inside
+		float distance_sq(const Aabb& box, const me::math::Vec3& p) {
+			const float dx = std::max({ box.min.x - p.x, 0.0f, p.x - box.max.x });
+			const float dy = std::max({ box.min.y - p.y, 0.0f, p.y - box.max.y });
+			const float dz = std::max({ box.min.z - p.z, 0.0f, p.z - box.max.z });
+			return dx * dx + dy * dy + dz * dz;
+		}
+
+		// Slab test. Entry distance in [0, max_t], or -1 for a miss.
+		float ray_box(const Aabb& box, const me::math::Vec3& origin, const me::math::Vec3& inv_dir, float max_t) {
+			float t0 = 0.0f, t1 = max_t;
+			const float o[3] = { origin.x, origin.y, origin.z };
+			const float inv[3] = { inv_dir.x, inv_dir.y, inv_dir.z };
+			const float lo[3] = { box.min.x, box.min.y, box.min.z };
+			const float hi[3] = { box.max.x, box.max.y, box.max.z };
+
+			for (int a = 0; a < 3; ++a) {
+				float tn = (lo[a] - o[a]) * inv[a];
+				float tf = (hi[a] - o[a]) * inv[a];
+				if (tn > tf) std::swap(tn, tf);
+				// NaN from 0 * inf (origin on a slab plane, axis-parallel ray) keeps the previous bound
+				t0 = tn > t0 ? tn : t0;
+				t1 = tf < t1 ? tf : t1;
+				if (t0 > t1) return -1.0f;
+			}
+			return t0;
+		}
+
+		// Inside (1), outside (-1) or crossing (0) the convex volume
+		int classify(const Aabb& box, std::span<const Plane> planes) {
+			int result = 1;
+			for (const Plane& plane : planes) {
+				const me::math::Vec3& n = plane.normal;
+
+				// Corner furthest along the normal, and the one furthest against it
+				const me::math::Vec3 far{ n.x >= 0 ? box.max.x : box.min.x, n.y >= 0 ? box.max.y : box.min.y, n.z >= 0 ? box.max.z : box.min.z };
+				const me::math::Vec3 near{ n.x >= 0 ? box.min.x : box.max.x, n.y >= 0 ? box.min.y : box.max.y, n.z >= 0 ? box.min.z : box.max.z };
+
+				if (n.dot(far) + plane.d < 0.0f) return -1;
+				if (n.dot(near) + plane.d < 0.0f) result = 0;
+			}
+			return result;
+		}
+
+		// Query scratch, one per thread so queries from workers don't allocate or contend
+		std::vector<std::int32_t>& stack() {
+			thread_local std::vector<std::int32_t> s;
+			s.clear();
+			return s;
+		}
+
+		// Depth-first walk: `enter(node)` decides whether to descend, `leaf(node)` handles leaves
+		template <typename Enter, typename Leaf>
+		void walk(Enter&& enter, Leaf&& leaf) {
+			const std::span<const Node> nodes = s_tree.nodes();
+			if (s_tree.root() == AabbTree::null) return;
+
+			auto& pending = stack();
+			pending.push_back(s_tree.root());
+			while (!pending.empty()) {
+				const Node& node = nodes[pending.back()];
+				pending.pop_back();
+
+				if (!enter(node)) continue;
+				if (node.is_leaf()) {
+					leaf(node);
+				} else {
+					pending.push_back(node.right);
+					pending.push_back(node.left);
+				}
+			}
+		}
+
+		void reset() {
+			s_tree.clear();
+			s_leaves.clear();
+			s_slot_leaf.clear();
+			s_stats = {};
+		}
+
+		// update(); `fresh` rescans every transform, otherwise the transform cache is reused if current this tick
+		void sync(bool fresh) {
+			ME_PROFILE_SCOPE("spatial::update");
+			s_active.store(true, std::memory_order_relaxed);
+
+			// Only update() writes the tree, so under s_update_mutex it reads the tree without s_mutex. s_mutex is
+			// taken exclusively just for the writes: waiting on jobs below may run a stolen job that queries.
+			std::lock_guard update_lock(s_update_mutex);
+			Registry& reg = me::get_registry();
+			if (s_owner != &reg) {
+				std::unique_lock lock(s_mutex);
+				s_owner = &reg;
+				reset();
+			}
+
+			if (fresh) me::transform::internal_update(reg);
+			else me::transform::internal_refresh(reg);
+			auto& pool = reg.view<TransformComponent>();
+			const me::transform::Matrix* world = me::transform::internal_world_matrices();
+
+			const std::size_t n = pool.size();
+			s_slot_leaf.resize(n, AabbTree::null);
+			++s_stamp;
+
+			// 1. Bounds of every transform. Slots still holding the same entity and inside its fat box are done.
+			auto tight = me::frame_arena().allocate_array<Aabb>(n);
+			auto state = me::frame_arena().allocate_array<std::uint8_t>(n);
+			const std::span<const Node> nodes = s_tree.nodes();
+
+			me::jobs::parallel_for_chunks(0, n, k_bounds_grain, [&](std::size_t begin, std::size_t end) {
+				for (std::size_t i = begin; i < end; ++i) {
+					tight[i] = bounds(world[i].m);
+
+					const std::int32_t leaf = s_slot_leaf[i];
+					if (leaf == AabbTree::null || static_cast<std::size_t>(leaf) >= nodes.size() || nodes[leaf].height != 0 || nodes[leaf].entity != pool.entity_map[i]) {
+						state[i] = Unknown;
+						continue;
+					}
+					state[i] = internal_contains(nodes[leaf].box, tight[i]) ? Unchanged : Moved;
+				}
+			});
+
+			std::unique_lock lock(s_mutex);
+
+			// 2. Inside the fat box only the tight box changes. The rest: slots that moved in the pool find their leaf
+			// by entity, new entities get one.
+			std::vector<std::pair<std::int32_t, std::size_t>> moves;   // Leaf, slot
+			std::vector<std::size_t> inserts;
+			bool unknown = false;
+
+			for (std::size_t i = 0; i < n; ++i) {
+				if (state[i] != Unknown) {
+					Node& node = s_tree.leaf(s_slot_leaf[i]);
+					node.stamp = s_stamp;
+					if (state[i] == Unchanged) node.tight = tight[i];
+					else moves.emplace_back(s_slot_leaf[i], i);
+					continue;
+				}
+
+				unknown = true;
+				auto it = s_leaves.find(pool.entity_map[i]);
+				if (it == s_leaves.end()) {
+					inserts.push_back(i);
+					continue;
+				}
+
+				const std::int32_t leaf = it->second;
+				Node& node = s_tree.leaf(leaf);
+				s_slot_leaf[i] = leaf;
+				node.stamp = s_stamp;
+				if (internal_contains(node.box, tight[i])) node.tight = tight[i];
+				else moves.emplace_back(leaf, i);
+			}
+
+			// 3. Leaves nobody claimed belong to destroyed entities (or ones that lost their transform)
+			std::size_t removed = 0;
+			if (unknown || n != s_tree.leaf_count()) {
+				for (std::size_t k = 0; k < s_tree.nodes().size(); ++k) {
+					const Node& node = s_tree.nodes()[k];
+					if (node.height != 0 || node.stamp == s_stamp) continue;
+
+					s_leaves.erase(node.entity);
+					s_tree.remove(static_cast<std::int32_t>(k));
+					++removed;
+				}
+			}
+
+			// 4. Apply: leaf by leaf when few changed, one rebuild when many did
+			const std::size_t changed = moves.size() + inserts.size();
+			const bool rebuild = changed >= k_rebuild_min && changed * k_rebuild_ratio > s_tree.leaf_count() + inserts.size();
+
+			for (const auto& [leaf, slot] : moves) {
+				if (rebuild) s_tree.move_deferred(leaf, tight[slot], fatten(tight[slot]));
+				else s_tree.move(leaf, tight[slot], fatten(tight[slot]));
+			}
+			for (std::size_t slot : inserts) {
+				const me::entity::entity_id e = pool.entity_map[slot];
+				const std::int32_t leaf = rebuild ? s_tree.insert_deferred(e, tight[slot], fatten(tight[slot])) : s_tree.insert(e, tight[slot], fatten(tight[slot]));
+				s_tree.leaf(leaf).stamp = s_stamp;
+				s_slot_leaf[slot] = leaf;
+				s_leaves[e] = leaf;
+			}
+			if (rebuild) s_tree.rebuild();
+
+			s_stats = { s_tree.leaf_count(), s_tree.node_count(), s_tree.height(), inserts.size(), moves.size(), removed, rebuild };
+			ME_PROFILE_COUNTER("spatial::moved", moves.size());
+		}
+	} // namespace
+
+	void update() {
+		sync(true);
+	}
+
+	void internal_frame_update() {
+		// The engine updated the transform cache right before
+		if (s_active.load(std::memory_order_relaxed)) sync(false);
+	}
+
+	bool raycast(const Ray& ray, RayHit& hit) {
+		s_active.store(true, std::memory_order_relaxed);
+		const float length = ray.direction.length();
+		if (length <= 0.0f) return false;
+
+		const me::math::Vec3 dir = ray.direction * (1.0f / length);
+		const me::math::Vec3 inv{ 1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z };
+
+		std::shared_lock lock(s_mutex);
+		float best = ray.max_distance;
+		bool found = false;
+
+		// Subtrees entered only while they could still hold a closer hit
+		walk([&](const Node& node) {
+			const float t = ray_box(node.box, ray.origin, inv, best);
+			return t >= 0.0f;
+		}, [&](const Node& node) {
+			const float t = ray_box(node.tight, ray.origin, inv, best);
+			if (t < 0.0f || (found && t >= best)) return;
+			best = t;
+			hit = { node.entity, t };
+			found = true;
+		});
+		return found;
+	}
+
+	std::size_t query_box(const Aabb& box, std::vector<me::entity::entity_id>& out) {
+		s_active.store(true, std::memory_order_relaxed);
+		out.clear();
+
+		std::shared_lock lock(s_mutex);
+		walk([&](const Node& node) { return internal_overlaps(node.box, box); },
+			[&](const Node& node) { if (internal_overlaps(node.tight, box)) out.push_back(node.entity); });
+		return out.size();
+	}
+
+	std::size_t query_sphere(const me::math::Vec3& center, float radius, std::vector<me::entity::entity_id>& out) {
+		s_active.store(true, std::memory_order_relaxed);
+		out.clear();
+		if (radius < 0.0f) return 0;
+
+		const float r2 = radius * radius;
+		std::shared_lock lock(s_mutex);
+		walk([&](const Node& node) { return distance_sq(node.box, center) <= r2; },
+			[&](const Node& node) { if (distance_sq(node.tight, center) <= r2) out.push_back(node.entity); });
+		return out.size();
+	}
+
+	std::size_t query_planes(std::span<const Plane> planes, std::vector<me::entity::entity_id>& out) {
+		s_active.store(true, std::memory_order_relaxed);
+		out.clear();
+
+		std::shared_lock lock(s_mutex);
+		const std::span<const Node> nodes = s_tree.nodes();
+		if (s_tree.root() == AabbTree::null) return 0;
+
+		// Subtrees fully inside are collected without further tests
+		std::vector<std::int32_t> inside;
+		walk([&](const Node& node) {
+			const int c = classify(node.box, planes);
+			if (c == 1 && !node.is_leaf()) {
+				inside.push_back(node.left);
+				inside.push_back(node.right);
+				return false;
+			}
+			return c >= 0;
+		}, [&](const Node& node) {
+			if (classify(node.tight, planes) >= 0) out.push_back(node.entity);
+		});
+
+		while (!inside.empty()) {
+			const Node& node = nodes[inside.back()];
+			inside.pop_back();
+			if (node.is_leaf()) {
+				out.push_back(node.entity);
+			} else {
+				inside.push_back(node.left);
+				inside.push_back(node.right);
+			}
+		}
+		return out.size();
+	}
+
+	std::size_t query_nearest(const me::math::Vec3& point, std::size_t k, std::vector<me::entity::entity_id>& out) {
+		s_active.store(true, std::memory_order_relaxed);
+		out.clear();
+		if (k == 0) return 0;
+
+		std::shared_lock lock(s_mutex);
+		const std::span<const Node> nodes = s_tree.nodes();
+		if (s_tree.root() == AabbTree::null) return 0;
+
+		// Best-first: a node's fat box distance is a lower bound for every leaf below it, so leaves pop in order.
+		// Leaves are queued a second time with their tight distance (tagged by a negative index).
+		using Entry = std::pair<float, std::int32_t>;
+		std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+		queue.emplace(distance_sq(nodes[s_tree.root()].box, point), s_tree.root());
+
+		while (!queue.empty() && out.size() < k) {
+			const auto [d, index] = queue.top();
+			queue.pop();
+
+			if (index < 0) {
+				out.push_back(nodes[-index - 1].entity);
+				continue;
+			}
+
+			const Node& node = nodes[index];
+			if (node.is_leaf()) {
+				queue.emplace(distance_sq(node.tight, point), -index - 1);
+			} else {
+				queue.emplace(distance_sq(nodes[node.left].box, point), node.left);
+				queue.emplace(distance_sq(nodes[node.right].box, point), node.right);
+			}
+		}
+		return out.size();
+	}
+
+	Stats stats() {
+		std::shared_lock lock(s_mutex);
+		return s_stats;
+	}
+
+} // namespace me::spatial
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace me::spatial {
+
+	// Internal-only: called by the engine loop after Application::on_update. Runs update() once any spatial
+	// function has been used, otherwise does nothing.
+	void internal_frame_update();
+
+} // namespace me::spatial
@@ -0,0 +1,47 @@
+// atlas_cook: offline texture atlas packing.
+//
+//   atlas_cook <image folder> <out base> [--padding N] [--max-size N] [--no-extrude]
+//
+// Packs every image under the folder and writes <out base>.png and <out base>.atlas.json.
+// At runtime, me::assets::load_atlas("<out base>") picks the cooked files up instead of packing again.
+
+#include <mini-engine-raylib/assets/assets.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv) {
+	me::assets::AtlasOptions options;
+	std::string folder;
+	std::string out_base;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+		const bool has_value = i + 1 < argc;
+
+		if (arg == "--padding" && has_value) options.padding = std::max(0, std::atoi(argv[++i]));
+		else if (arg == "--max-size" && has_value) options.max_size = std::max(1, std::atoi(argv[++i]));
+		else if (arg == "--no-extrude") options.extrude = false;
+		else if (folder.empty() && arg[0] != '-') folder = arg;
+		else if (out_base.empty() && arg[0] != '-') out_base = arg;
+		else {
+			folder.clear();
+			break;
+		}
+	}
+
+	if (folder.empty() || out_base.empty()) {
+		std::cerr << "usage: atlas_cook <image folder> <out base> [--padding N] [--max-size N] [--no-extrude]\n";
+		return 1;
+	}
+
+	if (!me::assets::cook_atlas(folder.c_str(), out_base.c_str(), options)) {
+		std::cerr << "atlas_cook: failed to cook " << folder << "\n";
+		return 1;
+	}
+
+	std::cout << "wrote " << out_base << ".png and " << out_base << ".atlas.json\n";
+	return 0;
+}
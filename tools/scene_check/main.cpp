@@ -0,0 +1,360 @@
+// scene_check: headless self-check of the scene formats, run by ctest.
+//
+//   scene_check [work_dir]
+//
+// Builds a scene with every engine component, parent chains, textures and a string component, then checks that
+// JSON -> .mescene -> registry -> JSON reproduces it field by field, with compressed and raw blocks, both ways
+// through scene_file::convert, and for an empty scene. Truncated and corrupted .mescene files must be rejected
+// without touching the registry. Exits non-zero on the first failure of each check.
+
+#include <mini-engine-raylib/assets/assets.hpp>
+#include <mini-engine-raylib/core/engine.hpp>
+#include <mini-engine-raylib/ecs/components.hpp>
+#include <mini-engine-raylib/ecs/reflect.hpp>
+#include <mini-engine-raylib/ecs/serialize.hpp>
+#include <mini-engine-raylib/ecs/transform_system.hpp>
+#include <mini-engine-raylib/scene/scene_file.hpp>
+
+#include <mini-ecs/registry.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace fs = std::filesystem;
+using json = nlohmann::ordered_json;
+using namespace me::components;
+
+// A user component: exercises string columns and registration
+struct CheckLabel {
+	std::string text;
+	int team = 0;
+};
+
+ME_REFLECT(CheckLabel, "CheckLabel", ME_FIELD(text), ME_FIELD(team));
+
+namespace {
+
+	int s_failures = 0;
+
+	void report(bool ok, const std::string& name, const std::string& detail = {}) {
+		std::cout << (ok ? "ok   " : "FAIL ") << name;
+		if (!detail.empty()) std::cout << ": " << detail;
+		std::cout << "\n";
+		if (!ok) ++s_failures;
+	}
+
+	// Every entity the scene formats can see owns a transform
+	void clear_scene(me::Registry& reg) {
+		auto& transforms = reg.view<TransformComponent>();
+		std::vector<me::entity::entity_id> entities(transforms.entity_map.begin(), transforms.entity_map.end());
+		for (me::entity::entity_id e : entities) reg.destroy_entity(e);
+	}
+
+	// Component counts per pool, to tell whether a failed load left anything behind
+	std::array<std::size_t, 7> pool_sizes(me::Registry& reg) {
+		return {
+			reg.view<TransformComponent>().size(),
+			reg.view<ParentComponent>().size(),
+			reg.view<CameraComponent>().size(),
+			reg.view<Camera2DComponent>().size(),
+			reg.view<MeshRendererComponent>().size(),
+			reg.view<SpriteComponent>().size(),
+			reg.view<CheckLabel>().size(),
+		};
+	}
+
+	void build_scene(me::Registry& reg, std::size_t count) {
+		const char* textures[] = { "tiles.png", "player/idle.png", "ui/\"quoted\".png" };
+		const char* labels[] = { "", "enemy", "line\nbreak", "tab\tand \\ slash", "caf\xc3\xa9" };
+
+		std::vector<me::entity::entity_id> entities;
+		for (std::size_t i = 0; i < count; ++i) {
+			const float f = static_cast<float>(i);
+			const me::entity::entity_id e = reg.create_entity("Entity");
+			reg.add_component(e, TransformComponent{ f * 0.5f, -f, f / 3.0f, f, 90.0f - f, 0.1f * f, 1.0f + f / 7.0f, 1.0f, 0.25f });
+
+			if (i % 3 == 0) {
+				MeshRendererComponent mesh;
+				mesh.type = static_cast<MeshRendererComponent::Type>(i % 3);
+				mesh.color = me::Color(static_cast<std::uint8_t>(i), 2, 3, static_cast<std::uint8_t>(255 - i % 256));
+				mesh.wireframe = i % 2 == 0;
+				mesh.layer = static_cast<decltype(mesh.layer)>(i % 5);
+				mesh.min_screen_size = f / 11.0f;
+				reg.add_component(e, mesh);
+			}
+			if (i % 4 == 0) {
+				SpriteComponent sprite;
+				if (i % 8 != 0) sprite.texture = me::assets::load_texture(textures[i % std::size(textures)]);
+				sprite.tint = me::Color(0, static_cast<std::uint8_t>(i), 0);
+				sprite.uv.u0 = 0.125f * static_cast<float>(i % 8);
+				reg.add_component(e, sprite);
+			}
+			if (i % 7 == 0) {
+				CameraComponent camera;
+				camera.fov = 30.0f + static_cast<float>(i % 60);
+				camera.active = i % 2 == 0;
+				reg.add_component(e, camera);
+			}
+			if (i % 11 == 0) {
+				Camera2DComponent camera;
+				camera.zoom = 1.0f + f;
+				camera.active = false;
+				reg.add_component(e, camera);
+			}
+			if (i % 5 == 0) reg.add_component(e, CheckLabel{ std::string(labels[i % std::size(labels)]) + std::to_string(i), static_cast<int>(i % 4) - 1 });
+
+			// Chains and fans, parents before and after their children in the pool
+			if (i % 6 == 1) me::transform::set_parent(e, entities[i - 1]);
+			else if (i % 6 == 4 && i >= 4) me::transform::set_parent(e, entities[i / 2]);
+			entities.push_back(e);
+		}
+
+		// A parent created after its child
+		if (count >= 2) {
+			const me::entity::entity_id late = reg.create_entity("Entity");
+			reg.add_component(late, TransformComponent{ 7.0f });
+			me::transform::set_parent(entities[0], late);
+		}
+	}
+
+	bool read_json(const fs::path& path, json& out) {
+		std::ifstream in(path, std::ios::binary);
+		if (!in) return false;
+		try { out = json::parse(in); } catch (...) { return false; }
+		return true;
+	}
+
+	std::vector<std::uint8_t> read_bytes(const fs::path& path) {
+		std::ifstream in(path, std::ios::binary);
+		return { std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>() };
+	}
+
+	void write_bytes(const fs::path& path, const std::uint8_t* data, std::size_t size) {
+		std::ofstream out(path, std::ios::binary | std::ios::trunc);
+		out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+	}
+
+	// Field-by-field comparison of two saved scenes. Entity ids differ between registries, so entities are matched
+	// by position (both saves walk the transform pool in load order) and Parent ids by the position they refer to.
+	bool same_scene(const json& a, const json& b, std::string& where) {
+		const json& ea = a.at("entities");
+		const json& eb = b.at("entities");
+		if (ea.size() != eb.size()) {
+			where = "entity count " + std::to_string(ea.size()) + " vs " + std::to_string(eb.size());
+			return false;
+		}
+
+		auto positions = [](const json& entities) {
+			std::unordered_map<std::uint64_t, std::size_t> out;
+			for (std::size_t i = 0; i < entities.size(); ++i) out[entities[i].at("id").get<std::uint64_t>()] = i;
+			return out;
+		};
+		const auto pa = positions(ea);
+		const auto pb = positions(eb);
+
+		for (std::size_t i = 0; i < ea.size(); ++i) {
+			const json& ca = ea[i].at("components");
+			const json& cb = eb[i].at("components");
+			const std::string at = "entities[" + std::to_string(i) + "]";
+			if (ca.size() != cb.size()) {
+				where = at + " component count " + std::to_string(ca.size()) + " vs " + std::to_string(cb.size());
+				return false;
+			}
+
+			for (const auto& [name, fields] : ca.items()) {
+				if (!cb.contains(name)) {
+					where = at + " is missing " + name;
+					return false;
+				}
+				if (name == me::reflect::name_of<ParentComponent>) {
+					const auto parent_a = pa.find(fields.at("id").get<std::uint64_t>());
+					const auto parent_b = pb.find(cb[name].at("id").get<std::uint64_t>());
+					if (parent_a == pa.end() || parent_b == pb.end() || parent_a->second != parent_b->second) {
+						where = at + ".Parent links to another entity";
+						return false;
+					}
+					continue;
+				}
+				for (const auto& [field, value] : fields.items()) {
+					if (!cb[name].contains(field) || cb[name][field] != value) {
+						where = at + "." + name + "." + field + ": " + value.dump() + " vs " + (cb[name].contains(field) ? cb[name][field].dump() : "missing");
+						return false;
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	// reference.json -> binary -> registry -> JSON, compared with the reference
+	void check_round_trip(me::Registry& reg, const fs::path& dir, const std::string& name, const json& reference, const fs::path& reference_path, bool compress) {
+		const fs::path binary = dir / (name + me::scene_file::k_binary_extension);
+		const fs::path resaved = dir / (name + ".resaved.json");
+		me::scene_file::BinaryOptions options;
+		options.compress = compress;
+
+		clear_scene(reg);
+		if (!me::scene_file::convert(reference_path, binary, options)) return report(false, name, "convert to binary failed");
+		if (!me::scene_file::load_binary(binary)) return report(false, name, "load_binary failed");
+
+		json result;
+		if (!me::scene_file::save_json(resaved) || !read_json(resaved, result)) return report(false, name, "save_json failed");
+
+		std::string where;
+		const bool same = same_scene(reference, result, where);
+		clear_scene(reg);
+		report(same, name, same ? std::to_string(reference.at("entities").size()) + " entities, " + std::to_string(fs::file_size(binary)) + " bytes" : where);
+
+		// Back the other way: binary -> JSON through convert
+		const fs::path converted = dir / (name + ".converted.json");
+		json back;
+		if (!me::scene_file::convert(binary, converted) || !read_json(converted, back)) return report(false, name + " (binary -> json)", "convert failed");
+		const bool same_back = same_scene(reference, back, where);
+		report(same_back, name + " (binary -> json)", same_back ? "" : where);
+	}
+
+	// A load that fails must leave the registry as it was
+	bool rejected(me::Registry& reg, const fs::path& path, std::string& detail) {
+		const auto before = pool_sizes(reg);
+		if (me::scene_file::load_binary(path)) {
+			detail = "accepted";
+			clear_scene(reg);
+			return false;
+		}
+		if (pool_sizes(reg) != before) {
+			detail = "registry changed";
+			return false;
+		}
+		return true;
+	}
+
+	void check_truncated(me::Registry& reg, const fs::path& dir, const fs::path& binary, const std::string& name) {
+		const std::vector<std::uint8_t> bytes = read_bytes(binary);
+		const fs::path damaged = dir / "damaged.mescene";
+		const std::size_t step = bytes.size() > 4096 ? bytes.size() / 2048 : 1;
+
+		std::string detail;
+		std::size_t cuts = 0;
+		for (std::size_t cut = 0; cut < bytes.size(); cut += step, ++cuts) {
+			write_bytes(damaged, bytes.data(), cut);
+			if (!rejected(reg, damaged, detail)) return report(false, name, "cut at " + std::to_string(cut) + " " + detail);
+		}
+		report(true, name, std::to_string(cuts) + " cuts rejected");
+	}
+
+	void check_corrupted(me::Registry& reg, const fs::path& dir, const fs::path& binary, const std::string& name) {
+		const std::vector<std::uint8_t> bytes = read_bytes(binary);
+		const fs::path damaged = dir / "damaged.mescene";
+		std::string detail;
+
+		// Header fields: magic, version, entity count, pool count, string count (u32 each after the 8-byte magic)
+		struct Patch { const char* what; std::size_t offset; std::uint32_t value; };
+		const Patch patches[] = {
+			{ "magic", 0, 0x4e414353u },
+			{ "version", 8, me::scene_file::k_binary_version + 1 },
+			{ "entity count", 12, 0xffffffffu },
+			{ "pool count", 16, 0xffffffffu },
+			{ "string count", 20, 0xffffffffu },
+		};
+		for (const Patch& patch : patches) {
+			std::vector<std::uint8_t> copy = bytes;
+			std::memcpy(copy.data() + patch.offset, &patch.value, sizeof(patch.value));
+			write_bytes(damaged, copy.data(), copy.size());
+			if (!rejected(reg, damaged, detail)) return report(false, name, std::string(patch.what) + " " + detail);
+		}
+
+		// Single bytes (every one of a small file): either rejected with the registry untouched, or loaded with
+		// no more entities than the header declares (a flipped float or color is still a valid file)
+		const std::size_t step = bytes.size() > 4096 ? bytes.size() / 2048 : 1;
+		std::size_t failed = 0, loaded = 0;
+		const std::size_t expected = static_cast<std::size_t>(bytes[12]) | static_cast<std::size_t>(bytes[13]) << 8 |
+			static_cast<std::size_t>(bytes[14]) << 16 | static_cast<std::size_t>(bytes[15]) << 24;
+		for (std::size_t i = 0; i < bytes.size(); i += step) {
+			std::vector<std::uint8_t> copy = bytes;
+			copy[i] ^= 0xa5;
+			write_bytes(damaged, copy.data(), copy.size());
+
+			const auto before = pool_sizes(reg);
+			if (me::scene_file::load_binary(damaged)) {
+				const std::size_t got = reg.view<TransformComponent>().size() - before[0];
+				clear_scene(reg);
+				if (got > expected) return report(false, name, "byte " + std::to_string(i) + " loaded " + std::to_string(got) + " entities");
+				++loaded;
+			} else if (pool_sizes(reg) != before) {
+				return report(false, name, "byte " + std::to_string(i) + " registry changed");
+			} else {
+				++failed;
+			}
+		}
+		report(true, name, std::to_string(failed) + " rejected, " + std::to_string(loaded) + " loaded as valid data");
+	}
+
+	int run_checks(const fs::path& dir) {
+		me::serialize::register_component<CheckLabel>();
+		me::Registry& reg = me::get_registry();
+		clear_scene(reg);
+
+		// Large enough that every column block is LZ-compressed
+		const fs::path reference_path = dir / "reference.json";
+		build_scene(reg, 3000);
+		json reference;
+		if (!me::scene_file::save_json(reference_path) || !read_json(reference_path, reference)) {
+			std::cerr << "scene_check: can't write " << reference_path << "\n";
+			return 1;
+		}
+		clear_scene(reg);
+
+		check_round_trip(reg, dir, "compressed", reference, reference_path, true);
+		check_round_trip(reg, dir, "raw", reference, reference_path, false);
+
+		const fs::path empty_path = dir / "empty.json";
+		json empty;
+		if (!me::scene_file::save_json(empty_path) || !read_json(empty_path, empty)) return report(false, "empty", "save_json failed"), 1;
+		check_round_trip(reg, dir, "empty", empty, empty_path, true);
+
+		// Small scene: every byte of it gets corrupted
+		const fs::path small_path = dir / "small.json";
+		build_scene(reg, 40);
+		json small;
+		if (!me::scene_file::save_json(small_path) || !read_json(small_path, small)) return report(false, "small", "save_json failed"), 1;
+		clear_scene(reg);
+		check_round_trip(reg, dir, "small", small, small_path, false);
+
+		check_truncated(reg, dir, dir / "compressed.mescene", "truncated (compressed)");
+		check_truncated(reg, dir, dir / "small.mescene", "truncated (raw)");
+		check_corrupted(reg, dir, dir / "small.mescene", "corrupted (raw)");
+		check_corrupted(reg, dir, dir / "compressed.mescene", "corrupted (compressed)");
+
+		std::cout << (s_failures == 0 ? "all scene checks passed\n" : "scene checks failed\n");
+		return s_failures == 0 ? 0 : 1;
+	}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const fs::path dir = argc > 1 ? fs::path(argv[1]) : fs::temp_directory_path() / "me_scene_check";
+	std::error_code ec;
+	fs::create_directories(dir, ec);
+
+	me::AppConfig config;
+	config.headless = true;
+	config.worker_threads = -1;   // Nothing here runs jobs
+	if (!me::init(config)) {
+		std::cerr << "scene_check: engine init failed\n";
+		return 1;
+	}
+
+	const int result = run_checks(dir);
+	me::shutdown();
+	return result;
+}
@@ -0,0 +1,54 @@
+// scene_convert: converts scene files between the authoring and shipping formats.
+//
+//   scene_convert <in> <out> [--no-compress]
+//
+// The format follows the extension: .mescene is binary, anything else JSON. Cook every scenes/<name>.json to
+// scenes/<name>.mescene for shipping; Scene::load_from_file picks the binary up when it isn't older than the JSON.
+// Textures are stored by URI and never loaded (the engine runs headless).
+
+#include <mini-engine-raylib/core/engine.hpp>
+#include <mini-engine-raylib/scene/scene_file.hpp>
+
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv) {
+	me::scene_file::BinaryOptions options;
+	std::string in;
+	std::string out;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string arg = argv[i];
+
+		if (arg == "--no-compress") options.compress = false;
+		else if (in.empty() && arg[0] != '-') in = arg;
+		else if (out.empty() && arg[0] != '-') out = arg;
+		else {
+			in.clear();
+			break;
+		}
+	}
+
+	if (in.empty() || out.empty()) {
+		std::cerr << "usage: scene_convert <in> <out> [--no-compress]\n";
+		return 1;
+	}
+
+	me::AppConfig config;
+	config.headless = true;
+	config.worker_threads = -1;   // Conversion runs on this thread
+	if (!me::init(config)) {
+		std::cerr << "scene_convert: engine init failed\n";
+		return 1;
+	}
+
+	const bool converted = me::scene_file::convert(in, out, options);
+	me::shutdown();
+	if (!converted) {
+		std::cerr << "scene_convert: failed to convert " << in << "\n";
+		return 1;
+	}
+
+	std::cout << "wrote " << out << "\n";
+	return 0;
+}